@@ -1,12 +1,13 @@
 local unpack = unpack
 local pack = table.pack
 
-local EventData, callbacks, updateableParameters, autoID = {}, {}, {}, 0
+local EventData, callbacks, names, updateableParameters, autoID = {}, {}, {}, {}, 0
 -- This metatable creates an auto-configuration mechanism to create new types of Events
 local ec = setmetatable({}, {
 	__newindex = function(self, key, value)
 		autoID = autoID + 1
 		callbacks[key] = autoID
+		names[autoID] = key
 		local info, update = {}, {}
 		for k, v in pairs(value) do
 			if type(k) == "string" then
@@ -107,6 +108,8 @@ local function register(self, triggerIndex)
 
 	table.sort(events,
 	           function(ecl, ecr) return ecl.triggerIndex < ecr.triggerIndex end)
+	-- events.xml methods marked callbacksOnly are only called while they have callbacks
+	Game.setEventCallbackCount(names[eventType], events.maxn)
 	self.eventType = nil
 	self.callback = nil
 	return true
@@ -115,7 +118,10 @@ end
 Event = setmetatable({
 	clear = function(self)
 		EventData = {}
-		for i = 1, autoID do EventData[i] = {maxn = 0} end
+		for i = 1, autoID do
+			EventData[i] = {maxn = 0}
+			Game.setEventCallbackCount(names[i], 0)
+		end
 	end
 }, {
 	__call = function(self) return setmetatable({register = register}, EventMeta) end,
@@ -0,0 +1,18 @@
+local fmt = string.format
+
+function onSay(player, words, param)
+	local stats = Game.getGlobalEventStats(math.max(1, tonumber(param) or 10))
+	if #stats == 0 then
+		player:sendTextMessage(MESSAGE_STATUS_CONSOLE_BLUE, "No globalevent has run yet.")
+		return false
+	end
+
+	local desc = {"Globalevents by total execution time:\n"}
+	for _, event in ipairs(stats) do
+		desc[#desc + 1] = fmt("%s: %.1f ms in %d runs, %.1f ms average, %.1f ms max", event.name, event.totalTime,
+			event.executions, event.totalTime / event.executions, event.maxTime)
+	end
+
+	player:popupFYI(table.concat(desc, "\n"))
+	return false
+end
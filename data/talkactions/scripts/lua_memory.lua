@@ -0,0 +1,29 @@
+local fmt = string.format
+
+local function formatBytes(bytes)
+	if bytes >= 1024 * 1024 then
+		return fmt("%.2f MiB", bytes / (1024 * 1024))
+	end
+	return fmt("%.2f KiB", bytes / 1024)
+end
+
+function onSay(player, words, param)
+	if param == "reset" then
+		Game.resetLuaMemoryUsage()
+		player:sendTextMessage(MESSAGE_STATUS_CONSOLE_BLUE, "Lua allocation statistics reset.")
+		return false
+	end
+
+	local usage = Game.getLuaMemoryUsage(math.max(1, tonumber(param) or 10))
+	local desc = {"Lua memory:\n"}
+	desc[#desc + 1] = fmt("In use: %s", formatBytes(usage.usedBytes))
+	desc[#desc + 1] = fmt("Allocated since start: %s", formatBytes(usage.allocatedBytes))
+
+	desc[#desc + 1] = "\nTop allocating scripts:"
+	for _, script in ipairs(usage.scripts) do
+		desc[#desc + 1] = fmt("%s: %s in %d allocations", script.name, formatBytes(script.bytes), script.allocations)
+	end
+
+	player:popupFYI(table.concat(desc, "\n"))
+	return false
+end
@@ -0,0 +1,31 @@
+local fmt = string.format
+
+local function formatBytes(bytes)
+	if bytes >= 1024 * 1024 then
+		return fmt("%.2f MiB", bytes / (1024 * 1024))
+	end
+	return fmt("%.2f KiB", bytes / 1024)
+end
+
+function onSay(player, words, param)
+	local usage = Game.getMemoryUsage()
+	local desc = {"Memory usage:\n"}
+
+	local attributes = usage.itemAttributes
+	desc[#desc + 1] = "Item attributes:"
+	desc[#desc + 1] = fmt("Items with attributes: %d (%d attributes, %d on the heap)", attributes.instances,
+	                      attributes.attributes, attributes.heapAttributeLists)
+	desc[#desc + 1] = fmt("Shared strings: %d (%d references)", attributes.sharedStrings,
+	                      attributes.sharedStringReferences)
+	desc[#desc + 1] = fmt("Storage: %s (previous layout: %s)", formatBytes(attributes.bytes),
+	                      formatBytes(attributes.legacyBytes))
+
+	desc[#desc + 1] = "\nSlab allocators:"
+	for _, slab in ipairs(usage.slabs) do
+		desc[#desc + 1] = fmt("%s (%d bytes): %d live, %d peak, %d allocated (%s)", slab.name, slab.objectSize,
+		                      slab.live, slab.peak, slab.capacity, formatBytes(slab.capacity * slab.objectSize))
+	end
+
+	player:popupFYI(table.concat(desc, "\n"))
+	return false
+end
@@ -0,0 +1,16 @@
+function onSay(player, words, param)
+	if param == "start" then
+		Game.startScriptProfiler()
+		player:sendTextMessage(MESSAGE_STATUS_CONSOLE_BLUE, "Script profiler started.")
+	elseif param == "stop" then
+		local fileName = Game.stopScriptProfiler()
+		if fileName then
+			player:sendTextMessage(MESSAGE_STATUS_CONSOLE_BLUE, "Script profile written to " .. fileName .. ".")
+		else
+			player:sendCancelMessage("The script profiler is not running or the profile could not be written.")
+		end
+	else
+		player:sendCancelMessage("Usage: " .. words .. " start|stop")
+	end
+	return false
+end
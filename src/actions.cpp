@@ -28,22 +28,46 @@ Actions::Actions() : scriptInterface("Action Interface") { scriptInterface.initS
 
 Actions::~Actions() { clear(false); }
 
-void Actions::clearMap(ActionUseMap& map, bool fromLua)
+bool Actions::ActionUseMap::emplace(uint16_t id, const Action& action)
 {
-	for (auto it = map.begin(); it != map.end();) {
+	auto result = actions.emplace(id, action);
+	if (!result.second) {
+		return false;
+	}
+
+	index.set(id, &result.first->second);
+	if (itemScriptEvent != 0) {
+		Item::items.setScriptEvent(id, static_cast<ItemScriptEvents_t>(itemScriptEvent));
+	}
+	return true;
+}
+
+void Actions::ActionUseMap::clear(bool fromLua)
+{
+	index.clear();
+	if (itemScriptEvent != 0) {
+		Item::items.resetScriptEvents(static_cast<ItemScriptEvents_t>(itemScriptEvent));
+	}
+
+	for (auto it = actions.begin(); it != actions.end();) {
 		if (fromLua == it->second.fromLua) {
-			it = map.erase(it);
-		} else {
-			++it;
+			it = actions.erase(it);
+			continue;
+		}
+
+		index.set(it->first, &it->second);
+		if (itemScriptEvent != 0) {
+			Item::items.setScriptEvent(it->first, static_cast<ItemScriptEvents_t>(itemScriptEvent));
 		}
+		++it;
 	}
 }
 
 void Actions::clear(bool fromLua)
 {
-	clearMap(useItemMap, fromLua);
-	clearMap(uniqueItemMap, fromLua);
-	clearMap(actionItemMap, fromLua);
+	useItemMap.clear(fromLua);
+	uniqueItemMap.clear(fromLua);
+	actionItemMap.clear(fromLua);
 
 	for (auto it = positionMap.begin(); it != positionMap.end();) {
 		if (fromLua == it->second.fromLua) {
@@ -77,8 +101,7 @@ bool Actions::registerEvent(Event_ptr event, const pugi::xml_node& node)
 	if ((attr = node.attribute("itemid"))) {
 		const std::vector<int32_t>& idList = vectorAtoi(explodeString(attr.as_string(), ";"));
 		for (const auto& id : idList) {
-			auto result = useItemMap.emplace(static_cast<uint16_t>(id), *action);
-			if (!result.second) {
+			if (!useItemMap.emplace(static_cast<uint16_t>(id), *action)) {
 				std::cout << "[Warning - Actions::registerEvent] Duplicate registered item with id: " << id
 				          << std::endl;
 				continue;
@@ -91,8 +114,7 @@ bool Actions::registerEvent(Event_ptr event, const pugi::xml_node& node)
 	if ((attr = node.attribute("uniqueid"))) {
 		const std::vector<int32_t>& uidList = vectorAtoi(explodeString(attr.as_string(), ";"));
 		for (const auto& uid : uidList) {
-			auto result = uniqueItemMap.emplace(static_cast<uint16_t>(uid), *action);
-			if (!result.second) {
+			if (!uniqueItemMap.emplace(static_cast<uint16_t>(uid), *action)) {
 				std::cout << "[Warning - Actions::registerEvent] Duplicate registered item with uniqueid: " << uid
 				          << std::endl;
 				continue;
@@ -105,8 +127,7 @@ bool Actions::registerEvent(Event_ptr event, const pugi::xml_node& node)
 	if ((attr = node.attribute("actionid"))) {
 		const std::vector<int32_t>& aidList = vectorAtoi(explodeString(attr.as_string(), ";"));
 		for (const auto& aid : aidList) {
-			auto result = actionItemMap.emplace(static_cast<uint16_t>(aid), *action);
-			if (!result.second) {
+			if (!actionItemMap.emplace(static_cast<uint16_t>(aid), *action)) {
 				std::cout << "[Warning - Actions::registerEvent] Duplicate registered item with actionid: " << aid
 				          << std::endl;
 				continue;
@@ -122,7 +143,7 @@ bool Actions::registerEvent(Event_ptr event, const pugi::xml_node& node)
 			uint16_t iterId = fromId;
 			uint16_t toId = pugi::cast<uint16_t>(toIdAttribute.value());
 			for (; iterId <= toId; iterId++) {
-				if (!useItemMap.emplace(iterId, *action).second) {
+				if (!useItemMap.emplace(iterId, *action)) {
 					std::cout << "[Warning - Actions::registerEvent] Duplicate registered item with id: " << iterId
 					          << " in fromid: " << fromId << ", toid: " << toId << std::endl;
 					continue;
@@ -141,7 +162,7 @@ bool Actions::registerEvent(Event_ptr event, const pugi::xml_node& node)
 			uint16_t iterUid = fromUid;
 			uint16_t toUid = pugi::cast<uint16_t>(toUidAttribute.value());
 			for (; iterUid <= toUid; iterUid++) {
-				if (!uniqueItemMap.emplace(iterUid, *action).second) {
+				if (!uniqueItemMap.emplace(iterUid, *action)) {
 					std::cout << "[Warning - Actions::registerEvent] Duplicate registered item with unique id: "
 					          << iterUid << " in fromuid: " << fromUid << ", touid: " << toUid << std::endl;
 					continue;
@@ -161,7 +182,7 @@ bool Actions::registerEvent(Event_ptr event, const pugi::xml_node& node)
 			uint16_t iterAid = fromAid;
 			uint16_t toAid = pugi::cast<uint16_t>(toAidAttribute.value());
 			for (; iterAid <= toAid; iterAid++) {
-				if (!actionItemMap.emplace(iterAid, *action).second) {
+				if (!actionItemMap.emplace(iterAid, *action)) {
 					std::cout << "[Warning - Actions::registerEvent] Duplicate registered item with action id: "
 					          << iterAid << " in fromaid: " << fromAid << ", toaid: " << toAid << std::endl;
 					continue;
@@ -200,7 +221,7 @@ bool Actions::registerLuaEvent(Action* event)
 
 	bool success = false;
 	for (const auto& id : ids) {
-		if (!useItemMap.emplace(id, *action).second) {
+		if (!useItemMap.emplace(id, *action)) {
 			std::cout << "[Warning - Actions::registerLuaEvent] Duplicate registered item with id: " << id
 			          << " in range from id: " << ids.front() << ", to id: " << ids.back() << std::endl;
 			continue;
@@ -210,7 +231,7 @@ bool Actions::registerLuaEvent(Action* event)
 	}
 
 	for (const auto& id : uids) {
-		if (!uniqueItemMap.emplace(id, *action).second) {
+		if (!uniqueItemMap.emplace(id, *action)) {
 			std::cout << "[Warning - Actions::registerLuaEvent] Duplicate registered item with uid: " << id
 			          << " in range from uid: " << uids.front() << ", to uid: " << uids.back() << std::endl;
 			continue;
@@ -220,7 +241,7 @@ bool Actions::registerLuaEvent(Action* event)
 	}
 
 	for (const auto& id : aids) {
-		if (!actionItemMap.emplace(id, *action).second) {
+		if (!actionItemMap.emplace(id, *action)) {
 			std::cout << "[Warning - Actions::registerLuaEvent] Duplicate registered item with aid: " << id
 			          << " in range from aid: " << aids.front() << ", to aid: " << aids.back() << std::endl;
 			continue;
@@ -296,26 +317,29 @@ ReturnValue Actions::canUseFar(const Creature* creature, const Position& toPos,
 Action* Actions::getAction(const Item* item)
 {
 	if (item->hasAttribute(ITEM_ATTRIBUTE_UNIQUEID)) {
-		auto it = uniqueItemMap.find(item->getUniqueId());
-		if (it != uniqueItemMap.end()) {
-			return &it->second;
+		if (Action* action = uniqueItemMap.find(item->getUniqueId())) {
+			return action;
 		}
 	}
 
 	if (item->hasAttribute(ITEM_ATTRIBUTE_ACTIONID)) {
-		auto it = actionItemMap.find(item->getActionId());
-		if (it != actionItemMap.end()) {
-			return &it->second;
+		if (Action* action = actionItemMap.find(item->getActionId())) {
+			return action;
 		}
 	}
 
-	auto it = useItemMap.find(item->getID());
-	if (it != useItemMap.end()) {
-		return &it->second;
+	const ItemType& it = Item::items[item->getID()];
+	if (it.hasScriptEvent(ITEM_SCRIPT_ACTION)) {
+		if (Action* action = useItemMap.find(item->getID())) {
+			return action;
+		}
 	}
 
 	// rune items
-	return g_spells->getRuneSpell(item->getID());
+	if (it.hasScriptEvent(ITEM_SCRIPT_RUNE)) {
+		return g_spells->getRuneSpell(item->getID());
+	}
+	return nullptr;
 }
 
 Action* Actions::getAction(const Position& pos)
@@ -699,8 +723,7 @@ bool Action::executeUse(Player* player, Item* item, const Position& fromPosition
 
 	scriptInterface->pushFunction(scriptId);
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	Lua::pushThing(L, item);
 	Lua::pushPosition(L, fromPosition);
@@ -6,6 +6,8 @@
 
 #include "baseevents.h"
 #include "enums.h"
+#include "idtable.h"
+#include "items.h"
 #include "luascript.h"
 
 class Action;
@@ -110,15 +112,29 @@ private:
 	Event_ptr getEvent(std::string_view nodeName) override;
 	bool registerEvent(Event_ptr event, const pugi::xml_node& node) override;
 
-	using ActionUseMap = std::map<uint16_t, Action>;
-	ActionUseMap useItemMap;
+	// owns the registered actions, lookups go through the flat id table
+	class ActionUseMap
+	{
+	public:
+		explicit ActionUseMap(uint8_t itemScriptEvent = 0) : itemScriptEvent{itemScriptEvent} {}
+
+		bool emplace(uint16_t id, const Action& action);
+		Action* find(uint16_t id) const { return index.get(id); }
+		void clear(bool fromLua);
+
+	private:
+		std::map<uint16_t, Action> actions;
+		IdTable<Action> index;
+		uint8_t itemScriptEvent;
+	};
+
+	ActionUseMap useItemMap{ITEM_SCRIPT_ACTION};
 	ActionUseMap uniqueItemMap;
 	ActionUseMap actionItemMap;
-	std::map<Position, Action> positionMap;
+	std::unordered_map<Position, Action> positionMap;
 
 	Action* getAction(const Item* item);
 	Action* getAction(const Position& pos);
-	void clearMap(ActionUseMap& map, bool fromLua);
 
 	LuaScriptInterface scriptInterface;
 };
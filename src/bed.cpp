@@ -23,11 +23,10 @@ Attr_ReadValue BedItem::readAttr(AttrTypes_t attr, PropStream& propStream)
 			}
 
 			if (guid != 0) {
-				auto name = IOLoginData::getNameByGuid(guid);
-				if (!name.empty()) {
-					setSpecialDescription(fmt::format("{} is sleeping there.", name));
-					g_game.setBedSleeper(this, guid);
-					sleeperGUID = guid;
+				if (mapLoadRegistrations) {
+					mapLoadRegistrations->bedSleepers.emplace_back(this, guid);
+				} else {
+					loadSleeper(guid);
 				}
 			}
 			return ATTR_READ_CONTINUE;
@@ -49,6 +48,16 @@ Attr_ReadValue BedItem::readAttr(AttrTypes_t attr, PropStream& propStream)
 	return Item::readAttr(attr, propStream);
 }
 
+void BedItem::loadSleeper(uint32_t guid)
+{
+	auto name = IOLoginData::getNameByGuid(guid);
+	if (!name.empty()) {
+		setSpecialDescription(fmt::format("{} is sleeping there.", name));
+		g_game.setBedSleeper(this, guid);
+		sleeperGUID = guid;
+	}
+}
+
 void BedItem::serializeAttr(PropWriteStream& propWriteStream) const
 {
 	if (sleeperGUID != 0) {
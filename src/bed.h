@@ -23,6 +23,8 @@ public:
 	bool canRemove() const override { return house == nullptr; }
 
 	uint32_t getSleeper() const { return sleeperGUID; }
+	// restores the sleeper saved with the bed, if that character still exists
+	void loadSleeper(uint32_t guid);
 
 	House* getHouse() const { return house; }
 	void setHouse(House* h) { house = h; }
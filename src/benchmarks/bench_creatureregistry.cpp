@@ -0,0 +1,64 @@
+#include "../otpch.h"
+
+#include "../creatureregistry.h"
+
+namespace {
+
+struct Dummy
+{
+	uint32_t value;
+};
+
+using Registry = CreatureRegistry<Dummy, 0x40000000, 20, 10>;
+
+} // namespace
+
+// creature id lookups: std::map against the slot registry
+int main()
+{
+	// a large map has tens of thousands of monsters, scheduled tasks resolve their ids all the time
+	constexpr size_t count = 50000;
+
+	std::vector<Dummy> creatures(count);
+	std::map<uint32_t, Dummy*> map;
+	Registry registry;
+	std::vector<uint32_t> ids;
+	for (size_t i = 0; i < count; ++i) {
+		creatures[i].value = static_cast<uint32_t>(i);
+		uint32_t id = registry.reserve();
+		registry.set(id, &creatures[i]);
+		map.emplace(id, &creatures[i]);
+		ids.push_back(id);
+	}
+
+	std::mt19937 generator{42};
+	std::shuffle(ids.begin(), ids.end(), generator);
+
+	constexpr int iterations = 50;
+	uint64_t sum = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; ++i) {
+		for (uint32_t id : ids) {
+			auto it = map.find(id);
+			sum += it != map.end() ? it->second->value : 0;
+		}
+	}
+	auto mapTime = std::chrono::steady_clock::now() - start;
+
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; ++i) {
+		for (uint32_t id : ids) {
+			const Dummy* creature = registry.get(id);
+			sum += creature ? creature->value : 0;
+		}
+	}
+	auto registryTime = std::chrono::steady_clock::now() - start;
+
+	std::cout << fmt::format("{:d} creatures, {:d} lookups (sum {:d}): std::map {:d} us, slot registry {:d} us", count,
+	                         count * iterations, sum,
+	                         std::chrono::duration_cast<std::chrono::microseconds>(mapTime).count(),
+	                         std::chrono::duration_cast<std::chrono::microseconds>(registryTime).count())
+	          << std::endl;
+	return 0;
+}
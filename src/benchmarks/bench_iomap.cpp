@@ -0,0 +1,40 @@
+#include "../otpch.h"
+
+#include "../iomap.h"
+
+namespace {
+
+void printMetrics(std::string_view name, const IOMap::LoadMetrics& metrics)
+{
+	std::cout << fmt::format("{:s}: {:d} tiles in {:d} areas, tree {:d} ms, decode {:d} ms on {:d} threads, merge {:d} "
+	                         "ms, total {:d} ms",
+	                         name, metrics.tiles, metrics.tileAreas, metrics.parseTree, metrics.decodeTileAreas,
+	                         metrics.threads, metrics.mergeTileAreas, metrics.total)
+	          << std::endl;
+}
+
+} // namespace
+
+// loads data/world/forgotten.otbm on one thread and on one thread per core
+int main()
+{
+	// items.xml is looked up relative to the working directory
+	std::filesystem::current_path(TFS_DATA_DIR "/..");
+	if (!Item::items.loadFromOtb("data/items/items.otb") || !Item::items.loadFromXml()) {
+		std::cout << "items could not be loaded" << std::endl;
+		return 1;
+	}
+
+	const std::filesystem::path fileName = "data/world/forgotten.otbm";
+	for (size_t threads : {size_t{1}, size_t{0}}) {
+		Map map;
+		IOMap loader;
+		loader.setThreadCount(threads);
+		if (!loader.loadMap(&map, fileName)) {
+			std::cout << fileName << ": " << loader.getLastErrorString() << std::endl;
+			return 1;
+		}
+		printMetrics(threads == 1 ? "serial" : "parallel", loader.getLoadMetrics());
+	}
+	return 0;
+}
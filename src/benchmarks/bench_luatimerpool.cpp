@@ -0,0 +1,95 @@
+#include "../otpch.h"
+
+#include "../luatimerpool.h"
+
+namespace {
+
+struct Timer
+{
+	int32_t function = -1;
+	std::vector<int32_t> parameters;
+};
+
+using Pool = LuaTimerPool<Timer>;
+
+} // namespace
+
+// addEvent timers: a descriptor map entry and a scheduler task per event against the pooled timers
+int main()
+{
+	// effect and countdown scripts: many short timers, some stopped before they fire
+	constexpr int timers = 200000;
+	constexpr int64_t tick = 50;
+
+	std::mt19937 generator{42};
+	std::vector<int64_t> delays(timers);
+	for (auto& delay : delays) {
+		delay = 100 + generator() % 2000;
+	}
+
+	int64_t fired = 0;
+	auto start = std::chrono::steady_clock::now();
+	{
+		// one descriptor map entry and one sorted timer per event, as with a scheduler task per addEvent
+		std::unordered_map<uint32_t, Timer> descriptors;
+		std::multimap<int64_t, uint32_t> scheduled;
+		uint32_t lastId = 0;
+		int64_t now = 0;
+		for (int i = 0; i < timers; ++i) {
+			uint32_t id = ++lastId;
+			descriptors.emplace(id, Timer{i, {i}});
+			scheduled.emplace(now + delays[i], id);
+			if (i % 4 == 0) {
+				descriptors.erase(id);
+			}
+
+			if (i % 100 == 0) {
+				now += tick;
+				while (!scheduled.empty() && scheduled.begin()->first <= now) {
+					auto it = descriptors.find(scheduled.begin()->second);
+					if (it != descriptors.end()) {
+						fired += it->second.function;
+						descriptors.erase(it);
+					}
+					scheduled.erase(scheduled.begin());
+				}
+			}
+		}
+	}
+	auto mapTime = std::chrono::steady_clock::now() - start;
+
+	int64_t pooledFired = 0;
+	start = std::chrono::steady_clock::now();
+	{
+		Pool pool;
+		int64_t now = 0;
+		for (int i = 0; i < timers; ++i) {
+			uint64_t id = pool.add(now + delays[i]);
+			Timer* timer = pool.find(id);
+			timer->function = i;
+			timer->parameters.push_back(i);
+			if (i % 4 == 0) {
+				pool.find(id)->parameters.clear();
+				pool.erase(id);
+			}
+
+			if (i % 100 == 0) {
+				now += tick;
+				while (uint64_t due = pool.nextDue(now)) {
+					Timer* dueTimer = pool.find(due);
+					pooledFired += dueTimer->function;
+					dueTimer->parameters.clear();
+					pool.erase(due);
+				}
+			}
+		}
+	}
+	auto poolTime = std::chrono::steady_clock::now() - start;
+
+	std::cout << fmt::format("{:d} timers (sums {:d}/{:d}): map and timer per event {:d} us, pooled timers {:d} us",
+	                         timers, fired, pooledFired,
+	                         std::chrono::duration_cast<std::chrono::microseconds>(mapTime).count(),
+	                         std::chrono::duration_cast<std::chrono::microseconds>(poolTime).count())
+	          << std::endl;
+	return 0;
+}
@@ -0,0 +1,74 @@
+#include "../otpch.h"
+
+#include "../luascript.h"
+
+namespace {
+
+struct Dummy
+{
+	uint32_t id;
+};
+
+void pushUncached(lua_State* L, Dummy* dummy)
+{
+	Lua::pushUserdata<Dummy>(L, dummy);
+	Lua::setMetatable(L, -1, "Dummy");
+}
+
+void pushCached(lua_State* L, Dummy* dummy)
+{
+	if (Lua::pushCachedUserdata(L, dummy->id, dummy)) {
+		return;
+	}
+
+	pushUncached(L, dummy);
+	Lua::cacheUserdata(L, dummy->id);
+}
+
+} // namespace
+
+// event calls handing the same players to a handler: a new userdata per call against the userdata cache
+int main()
+{
+	lua_State* L = luaL_newstate();
+	luaL_openlibs(L);
+	luaL_newmetatable(L, "Dummy");
+	lua_pop(L, 1);
+
+	// stands in for an onGainExperience handler: receives the player and returns the experience
+	luaL_dostring(L, "function onGainExperience(player, source, exp) return exp end");
+
+	std::vector<Dummy> players(100);
+	for (size_t i = 0; i < players.size(); ++i) {
+		players[i].id = static_cast<uint32_t>(0x10000000 + i);
+	}
+
+	constexpr int iterations = 1000000;
+
+	auto run = [&](auto push) {
+		lua_Integer sum = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i) {
+			lua_getglobal(L, "onGainExperience");
+			push(L, &players[i % players.size()]);
+			lua_pushnil(L);
+			lua_pushinteger(L, i);
+			lua_pcall(L, 3, 1, 0);
+			sum += lua_tointeger(L, -1);
+			lua_pop(L, 1);
+		}
+		return std::make_pair(std::chrono::steady_clock::now() - start, sum);
+	};
+
+	auto [uncached, uncachedSum] = run(pushUncached);
+	lua_gc(L, LUA_GCCOLLECT);
+	auto [cached, cachedSum] = run(pushCached);
+	lua_close(L);
+
+	std::cout << fmt::format("{:d} event calls (sums {:d}/{:d}): new userdata {:d} us, cached userdata {:d} us",
+	                         iterations, uncachedSum, cachedSum,
+	                         std::chrono::duration_cast<std::chrono::microseconds>(uncached).count(),
+	                         std::chrono::duration_cast<std::chrono::microseconds>(cached).count())
+	          << std::endl;
+	return 0;
+}
@@ -0,0 +1,81 @@
+#include "../otpch.h"
+
+#include "../prefixtree.h"
+#include "../tools.h"
+
+namespace {
+
+struct Words
+{
+	std::string words;
+};
+
+const Words* findLongestLinear(const std::map<std::string, Words>& map, std::string_view str)
+{
+	const Words* result = nullptr;
+	for (const auto& it : map) {
+		if (caseInsensitiveStartsWith(str, it.first) && (!result || it.first.size() > result->words.size())) {
+			result = &it.second;
+		}
+	}
+	return result;
+}
+
+} // namespace
+
+// instant spell lookup by spoken words: linear scan of the spell map against the prefix tree
+int main()
+{
+	pugi::xml_document doc;
+	if (!doc.load_file(TFS_DATA_DIR "/spells/spells.xml")) {
+		std::cout << "spells.xml not found" << std::endl;
+		return 1;
+	}
+
+	std::map<std::string, Words> map;
+	PrefixTree<Words> tree;
+	for (auto& node : doc.child("spells").children("instant")) {
+		std::string words = node.attribute("words").as_string();
+		auto [it, inserted] = map.emplace(words, Words{words});
+		if (inserted) {
+			tree.insert(it->first, &it->second);
+		}
+	}
+
+	// every spell as spoken, with a parameter and as plain chat that matches nothing
+	std::vector<std::string> lines;
+	for (const auto& it : map) {
+		std::string upper = it.first;
+		std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+
+		lines.push_back(it.first);
+		lines.push_back(upper + " \"Param\"");
+		lines.push_back("hello " + it.first);
+	}
+
+	constexpr int iterations = 1000;
+	size_t hits = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; ++i) {
+		for (const auto& line : lines) {
+			hits += findLongestLinear(map, line) != nullptr;
+		}
+	}
+	auto linear = std::chrono::steady_clock::now() - start;
+
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; ++i) {
+		for (const auto& line : lines) {
+			hits += tree.findLongestPrefix(line) != nullptr;
+		}
+	}
+	auto indexed = std::chrono::steady_clock::now() - start;
+
+	std::cout << fmt::format("{:d} spells, {:d} lookups ({:d} hits): linear scan {:d} us, prefix tree {:d} us",
+	                         map.size(), lines.size() * iterations, hits,
+	                         std::chrono::duration_cast<std::chrono::microseconds>(linear).count(),
+	                         std::chrono::duration_cast<std::chrono::microseconds>(indexed).count())
+	          << std::endl;
+	return 0;
+}
@@ -0,0 +1,77 @@
+#include "../otpch.h"
+
+#include "../storagemap.h"
+
+namespace {
+
+// quest storages are mostly small ranges of consecutive keys, a few of them far apart
+std::vector<uint32_t> questKeys(size_t count)
+{
+	std::vector<uint32_t> keys;
+	std::unordered_set<uint32_t> seen;
+	std::mt19937 generator{static_cast<uint32_t>(count)};
+	while (keys.size() < count) {
+		uint32_t base = generator() % 100000 + 10000;
+		for (uint32_t i = 0; i < 50 && keys.size() < count; ++i) {
+			if (seen.insert(base + i).second) {
+				keys.push_back(base + i);
+			}
+		}
+	}
+	return keys;
+}
+
+} // namespace
+
+// storage lookups of a player with many quest storages: std::map against StorageMap, and the rows a save writes
+int main()
+{
+	for (size_t count : {5000, 20000}) {
+		const auto keys = questKeys(count);
+
+		std::map<uint32_t, int64_t> map;
+		StorageMap storages;
+		for (uint32_t key : keys) {
+			map.insert_or_assign(key, 1);
+			storages.set(key, 1, false);
+		}
+
+		// a session reads storages far more often than it writes them
+		constexpr int iterations = 200;
+		int64_t sum = 0;
+
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i) {
+			for (uint32_t key : keys) {
+				auto it = map.find(key);
+				sum += it != map.end() ? it->second : 0;
+			}
+		}
+		auto mapTime = std::chrono::steady_clock::now() - start;
+
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i) {
+			for (uint32_t key : keys) {
+				sum += storages.get(key).value_or(0);
+			}
+		}
+		auto flatTime = std::chrono::steady_clock::now() - start;
+
+		// between two saves a player typically touches a few dozen storages
+		for (size_t i = 0; i < 40; ++i) {
+			storages.set(keys[i * keys.size() / 40], 2);
+		}
+
+		size_t dirty = 0;
+		storages.forEachDirty([&](uint32_t, std::optional<int64_t>) { ++dirty; });
+
+		std::cout << fmt::format("{:d} storages, {:d} lookups (sum {:d}): std::map {:d} us, flat map {:d} us; a save "
+		                         "writes {:d} rows instead of {:d}",
+		                         keys.size(), keys.size() * iterations, sum,
+		                         std::chrono::duration_cast<std::chrono::microseconds>(mapTime).count(),
+		                         std::chrono::duration_cast<std::chrono::microseconds>(flatTime).count(), dirty,
+		                         storages.size())
+		          << std::endl;
+	}
+	return 0;
+}
@@ -260,6 +260,9 @@ ReturnValue Combat::canDoCombat(Creature* caster, Tile* tile, bool aggressive)
 		return RETURNVALUE_ACTIONNOTPERMITTEDINPROTECTIONZONE;
 	}
 
+	if (!g_events->hasHook(EventHook::CREATURE_ONAREACOMBAT)) {
+		return RETURNVALUE_NOERROR;
+	}
 	return g_events->eventCreatureOnAreaCombat(caster, tile, aggressive);
 }
 
@@ -289,6 +292,9 @@ bool Combat::isProtected(const Player* attacker, const Player* target)
 ReturnValue Combat::canDoCombat(Creature* attacker, Creature* target)
 {
 	if (!attacker) {
+		if (!g_events->hasHook(EventHook::CREATURE_ONTARGETCOMBAT)) {
+			return RETURNVALUE_NOERROR;
+		}
 		return g_events->eventCreatureOnTargetCombat(attacker, target);
 	}
 
@@ -368,6 +374,10 @@ ReturnValue Combat::canDoCombat(Creature* attacker, Creature* target)
 			}
 		}
 	}
+
+	if (!g_events->hasHook(EventHook::CREATURE_ONTARGETCOMBAT)) {
+		return RETURNVALUE_NOERROR;
+	}
 	return g_events->eventCreatureOnTargetCombat(attacker, target);
 }
 
@@ -1079,8 +1089,7 @@ void ValueCallback::getMinMaxValues(Player* player, CombatDamage& damage) const
 
 	scriptInterface->pushFunction(scriptId);
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	int parameters = 1;
 	switch (type) {
@@ -1162,8 +1171,7 @@ void TileCallback::onTileCombat(Creature* creature, Tile* tile) const
 
 	scriptInterface->pushFunction(scriptId);
 	if (creature) {
-		Lua::pushUserdata<Creature>(L, creature);
-		Lua::setCreatureMetatable(L, -1, creature);
+		Lua::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -1193,15 +1201,13 @@ void TargetCallback::onTargetCombat(Creature* creature, Creature* target) const
 	scriptInterface->pushFunction(scriptId);
 
 	if (creature) {
-		Lua::pushUserdata<Creature>(L, creature);
-		Lua::setCreatureMetatable(L, -1, creature);
+		Lua::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
 
 	if (target) {
-		Lua::pushUserdata<Creature>(L, target);
-		Lua::setCreatureMetatable(L, -1, target);
+		Lua::pushCreature(L, target);
 	} else {
 		lua_pushnil(L);
 	}
@@ -43,7 +43,7 @@ int32_t Condition::getParam(ConditionParam_t param) const
 {
 	switch (param) {
 		case CONDITION_PARAM_TICKS:
-			return ticks;
+			return getTicks();
 
 		case CONDITION_PARAM_BUFF_SPELL:
 			return isBuff ? 1 : 0;
@@ -149,7 +149,7 @@ void Condition::serialize(PropWriteStream& propWriteStream)
 	propWriteStream.write<uint32_t>(id);
 
 	propWriteStream.write<uint8_t>(CONDITIONATTR_TICKS);
-	propWriteStream.write<uint32_t>(ticks);
+	propWriteStream.write<uint32_t>(getTicks());
 
 	propWriteStream.write<uint8_t>(CONDITIONATTR_ISBUFF);
 	propWriteStream.write<uint8_t>(isBuff);
@@ -171,6 +171,15 @@ void Condition::serialize(PropWriteStream& propWriteStream)
 
 void Condition::setEndTime(int64_t newEndTime) { endTime = newEndTime; }
 
+int32_t Condition::getTicks() const
+{
+	// non periodic conditions are not executed every interval, what is left of them follows from the end time
+	if (!periodic && ticks > 0 && endTime != 0) {
+		return static_cast<int32_t>(std::clamp<int64_t>(endTime - OTSYS_TIME(), 0, ticks));
+	}
+	return ticks;
+}
+
 void Condition::setTicks(int32_t newTicks)
 {
 	ticks = newTicks;
@@ -92,9 +92,10 @@ public:
 	ConditionType_t getType() const { return conditionType; }
 	int64_t getEndTime() const { return endTime; }
 	void setEndTime(int64_t newEndTime);
-	int32_t getTicks() const { return ticks; }
+	int32_t getTicks() const;
 	void setTicks(int32_t newTicks);
 	bool isAggressive() const { return aggressive; }
+	bool isPeriodic() const { return periodic; }
 
 	static Condition* createCondition(ConditionId_t id, ConditionType_t type, int32_t ticks, int32_t param = 0,
 	                                  bool buff = false, uint32_t subId = 0, bool aggressive = false);
@@ -124,6 +125,10 @@ protected:
 	bool aggressive;
 	bool constant = false;
 
+	// Periodic conditions do something every interval (damage, regeneration, light fading). All others are only
+	// executed by their creature once their end time has passed.
+	bool periodic = false;
+
 private:
 	ConditionId_t id;
 };
@@ -194,7 +199,9 @@ public:
 	ConditionRegeneration(ConditionId_t id, ConditionType_t type, int32_t ticks, bool buff = false, uint32_t subId = 0,
 	                      bool aggressive = false) :
 	    ConditionGeneric(id, type, ticks, buff, subId, aggressive)
-	{}
+	{
+		periodic = true;
+	}
 
 	void addCondition(Creature* creature, const Condition* condition) override;
 	bool executeCondition(Creature* creature, int32_t interval) override;
@@ -226,7 +233,9 @@ public:
 	ConditionSoul(ConditionId_t id, ConditionType_t type, int32_t ticks, bool buff = false, uint32_t subId = 0,
 	              bool aggressive = false) :
 	    ConditionGeneric(id, type, ticks, buff, subId, aggressive)
-	{}
+	{
+		periodic = true;
+	}
 
 	void addCondition(Creature* creature, const Condition* condition) override;
 	bool executeCondition(Creature* creature, int32_t interval) override;
@@ -263,11 +272,13 @@ public:
 class ConditionDamage final : public Condition
 {
 public:
-	ConditionDamage() = default;
+	ConditionDamage() { periodic = true; }
 	ConditionDamage(ConditionId_t id, ConditionType_t type, bool buff = false, uint32_t subId = 0,
 	                bool aggressive = true) :
 	    Condition(id, type, 0, buff, subId, aggressive)
-	{}
+	{
+		periodic = true;
+	}
 
 	static void generateDamageList(int32_t amount, int32_t start, std::list<int32_t>& list);
 
@@ -382,7 +393,9 @@ public:
 	ConditionLight(ConditionId_t id, ConditionType_t type, int32_t ticks, bool buff, uint32_t subId, uint8_t lightlevel,
 	               uint8_t lightcolor, bool aggressive = false) :
 	    Condition(id, type, ticks, buff, subId, aggressive), lightInfo(lightlevel, lightcolor)
-	{}
+	{
+		periodic = true;
+	}
 
 	bool startCondition(Creature* creature) override;
 	bool executeCondition(Creature* creature, int32_t interval) override;
@@ -277,6 +277,7 @@ bool ConfigManager::load()
 	booleans[Boolean::CLASSIC_EQUIPMENT_SLOTS] = getGlobalBoolean(L, "classicEquipmentSlots", false);
 	booleans[Boolean::CLASSIC_ATTACK_SPEED] = getGlobalBoolean(L, "classicAttackSpeed", false);
 	booleans[Boolean::SCRIPTS_CONSOLE_LOGS] = getGlobalBoolean(L, "showScriptsLogInConsole", true);
+	booleans[Boolean::LUA_BYTECODE_CACHE] = getGlobalBoolean(L, "luaBytecodeCache", true);
 	booleans[Boolean::SERVER_SAVE_NOTIFY_MESSAGE] = getGlobalBoolean(L, "serverSaveNotifyMessage", true);
 	booleans[Boolean::SERVER_SAVE_CLEAN_MAP] = getGlobalBoolean(L, "serverSaveCleanMap", false);
 	booleans[Boolean::SERVER_SAVE_CLOSE] = getGlobalBoolean(L, "serverSaveClose", false);
@@ -285,6 +286,7 @@ bool ConfigManager::load()
 	booleans[Boolean::YELL_ALLOW_PREMIUM] = getGlobalBoolean(L, "yellAlwaysAllowPremium", false);
 	booleans[Boolean::PREMIUM_TO_SEND_PRIVATE] = getGlobalBoolean(L, "premiumToSendPrivate", false);
 	booleans[Boolean::FORCE_MONSTERTYPE_LOAD] = getGlobalBoolean(L, "forceMonsterTypesOnLoad", true);
+	booleans[Boolean::PRELOAD_MONSTERTYPES] = getGlobalBoolean(L, "preloadMonsterTypes", false);
 	booleans[Boolean::DEFAULT_WORLD_LIGHT] = getGlobalBoolean(L, "defaultWorldLight", true);
 	booleans[Boolean::HOUSE_OWNED_BY_ACCOUNT] = getGlobalBoolean(L, "houseOwnedByAccount", false);
 	booleans[Boolean::CLEAN_PROTECTION_ZONES] = getGlobalBoolean(L, "cleanProtectionZones", false);
@@ -311,6 +313,7 @@ bool ConfigManager::load()
 	strings[String::LOCATION] = getGlobalString(L, "location", "");
 	strings[String::MOTD] = getGlobalString(L, "motd", "");
 	strings[String::WORLD_TYPE] = getGlobalString(L, "worldType", "pvp");
+	strings[String::LUA_GC_MODE] = getGlobalString(L, "luaGcMode", "incremental");
 
 	Monster::despawnRange = getGlobalInteger(L, "deSpawnRange", 2);
 	Monster::despawnRadius = getGlobalInteger(L, "deSpawnRadius", 50);
@@ -383,6 +386,12 @@ bool ConfigManager::load()
 	integers[Integer::MAX_ALLOWED_ON_A_DUMMY] = getGlobalInteger(L, "maxAllowedOnADummy", 5);
 	integers[Integer::RATE_EXERCISE_TRAINING_SPEED] = getGlobalInteger(L, "rateExerciseTrainingSpeed", 1.0);
 	integers[Integer::DLL_CHECK_KICK_TIME] = getGlobalInteger(L, "dllCheckKickTime", 300);
+	integers[Integer::LUA_GC_PAUSE] = getGlobalInteger(L, "luaGcPause", 200);
+	integers[Integer::LUA_GC_STEP_MULTIPLIER] = getGlobalInteger(L, "luaGcStepMultiplier", 100);
+	integers[Integer::LUA_GC_MINOR_MULTIPLIER] = getGlobalInteger(L, "luaGcMinorMultiplier", 20);
+	integers[Integer::LUA_GC_MAJOR_MULTIPLIER] = getGlobalInteger(L, "luaGcMajorMultiplier", 100);
+	integers[Integer::LUA_GC_IDLE_STEP] = getGlobalInteger(L, "luaGcIdleStep", 64);
+	integers[Integer::SLOW_QUERY_WARNING] = getGlobalInteger(L, "slowQueryWarning", 50);
 
 	expStages = loadXMLStages();
 	if (expStages.empty()) {
@@ -31,6 +31,7 @@ enum Boolean
 	CLASSIC_EQUIPMENT_SLOTS,
 	CLASSIC_ATTACK_SPEED,
 	SCRIPTS_CONSOLE_LOGS,
+	LUA_BYTECODE_CACHE,
 	SERVER_SAVE_NOTIFY_MESSAGE,
 	SERVER_SAVE_CLEAN_MAP,
 	SERVER_SAVE_CLOSE,
@@ -39,6 +40,7 @@ enum Boolean
 	YELL_ALLOW_PREMIUM,
 	PREMIUM_TO_SEND_PRIVATE,
 	FORCE_MONSTERTYPE_LOAD,
+	PRELOAD_MONSTERTYPES,
 	DEFAULT_WORLD_LIGHT,
 	HOUSE_OWNED_BY_ACCOUNT,
 	CLEAN_PROTECTION_ZONES,
@@ -80,6 +82,7 @@ enum String
 	MAP_AUTHOR,
 	CONFIG_FILE,
 	LOG_LEVEL,
+	LUA_GC_MODE,
 
 	LAST_STRING /* this must be the last one */
 };
@@ -155,6 +158,12 @@ enum Integer
 	MAX_ALLOWED_ON_A_DUMMY,
 	RATE_EXERCISE_TRAINING_SPEED,
 	DLL_CHECK_KICK_TIME,
+	LUA_GC_PAUSE,
+	LUA_GC_STEP_MULTIPLIER,
+	LUA_GC_MINOR_MULTIPLIER,
+	LUA_GC_MAJOR_MULTIPLIER,
+	LUA_GC_IDLE_STEP,
+	SLOW_QUERY_WARNING,
 
 	LAST_INTEGER /* this must be the last one */
 };
@@ -7,9 +7,25 @@
 
 #include "game.h"
 #include "iomap.h"
+#include "slab.h"
 
 extern Game g_game;
 
+namespace {
+
+SlabAllocator& getContainerAllocator()
+{
+	// never destroyed, containers may still be released during static destruction
+	static auto* allocator = new SlabAllocator("Container", sizeof(Container));
+	return *allocator;
+}
+
+} // namespace
+
+void* Container::operator new(size_t size) { return getContainerAllocator().allocate(size); }
+
+void Container::operator delete(void* p, size_t size) { getContainerAllocator().deallocate(p, size); }
+
 Container::Container(uint16_t type) : Container(type, items[type].maxItems) {}
 
 Container::Container(uint16_t type, uint16_t size) : Item(type), maxSize(size) {}
@@ -430,6 +446,10 @@ void Container::addThing(int32_t index, Thing* thing)
 	itemlist.push_front(item);
 	updateItemWeight(item->getWeight());
 
+	if (const Player* player = getHoldingPlayer()) {
+		player->addItemTypeCounts(item);
+	}
+
 	// send change to client
 	if (getParent() && (getParent() != VirtualCylinder::virtualCylinder)) {
 		onAddContainerItem(item);
@@ -441,6 +461,10 @@ void Container::addItemBack(Item* item)
 	addItem(item);
 	updateItemWeight(item->getWeight());
 
+	if (const Player* player = getHoldingPlayer()) {
+		player->addItemTypeCounts(item);
+	}
+
 	// send change to client
 	if (getParent() && (getParent() != VirtualCylinder::virtualCylinder)) {
 		onAddContainerItem(item);
@@ -459,11 +483,20 @@ void Container::updateThing(Thing* thing, uint16_t itemId, uint32_t count)
 		return /*RETURNVALUE_NOTPOSSIBLE*/;
 	}
 
+	const Player* player = getHoldingPlayer();
+	if (player) {
+		player->changeItemTypeCount(item->getID(), -static_cast<int32_t>(item->getItemCount()));
+	}
+
 	const int32_t oldWeight = item->getWeight();
 	item->setID(itemId);
 	item->setSubType(static_cast<uint16_t>(count));
 	updateItemWeight(-oldWeight + item->getWeight());
 
+	if (player) {
+		player->changeItemTypeCount(item->getID(), item->getItemCount());
+	}
+
 	// send change to client
 	if (getParent()) {
 		onUpdateContainerItem(index, item, item);
@@ -486,6 +519,11 @@ void Container::replaceThing(uint32_t index, Thing* thing)
 	item->setParent(this);
 	updateItemWeight(-static_cast<int32_t>(replacedItem->getWeight()) + item->getWeight());
 
+	if (const Player* player = getHoldingPlayer()) {
+		player->removeItemTypeCounts(replacedItem);
+		player->addItemTypeCounts(item);
+	}
+
 	// send change to client
 	if (getParent()) {
 		onUpdateContainerItem(index, replacedItem, item);
@@ -509,6 +547,9 @@ void Container::removeThing(Thing* thing, uint32_t count)
 	if (item->isStackable() && count != item->getItemCount()) {
 		uint8_t newCount = static_cast<uint8_t>(std::max<int32_t>(0, item->getItemCount() - count));
 		const int32_t oldWeight = item->getWeight();
+		if (const Player* player = getHoldingPlayer()) {
+			player->changeItemTypeCount(item->getID(), newCount - item->getItemCount());
+		}
 		item->setItemCount(newCount);
 		updateItemWeight(-oldWeight + item->getWeight());
 
@@ -519,6 +560,10 @@ void Container::removeThing(Thing* thing, uint32_t count)
 	} else {
 		updateItemWeight(-static_cast<int32_t>(item->getWeight()));
 
+		if (const Player* player = getHoldingPlayer()) {
+			player->removeItemTypeCounts(item);
+		}
+
 		// send change to client
 		if (getParent()) {
 			onRemoveContainerItem(index, item);
@@ -624,6 +669,10 @@ void Container::internalAddThing(uint32_t, Thing* thing)
 	itemlist.push_front(item);
 	updateItemWeight(item->getWeight());
 
+	if (const Player* player = getHoldingPlayer()) {
+		player->addItemTypeCounts(item);
+	}
+
 	if (getID() == ITEM_REWARD_CONTAINER && item->isStackable()) {
 		item->removeAttribute(ITEM_ATTRIBUTE_DATE);
 		item->removeAttribute(ITEM_ATTRIBUTE_REWARDID);
@@ -39,6 +39,10 @@ public:
 	Container(uint16_t type, uint16_t size);
 	~Container();
 
+	// allocated from a slab, see slab.h
+	static void* operator new(size_t size);
+	static void operator delete(void* p, size_t size);
+
 	// non-copyable
 	Container(const Container&) = delete;
 	Container& operator=(const Container&) = delete;
@@ -1374,23 +1374,30 @@ Condition* Creature::getCondition(ConditionType_t type, ConditionId_t conditionI
 
 void Creature::executeConditions(uint32_t interval)
 {
-	ConditionList tempConditions{conditions};
-	for (Condition* condition : tempConditions) {
-		auto it = std::find(conditions.begin(), conditions.end(), condition);
-		if (it == conditions.end()) {
+	int64_t timeNow = OTSYS_TIME();
+
+	// conditions added during this tick are executed from the next one on
+	conditions.beginDeferredErase();
+	for (size_t i = 0, size = conditions.slotCount(); i < size; ++i) {
+		Condition* condition = conditions.slot(i);
+		if (!condition) {
 			continue;
 		}
 
-		if (!condition->executeCondition(this, interval)) {
-			it = std::find(conditions.begin(), conditions.end(), condition);
-			if (it != conditions.end()) {
-				conditions.erase(it);
-				condition->endCondition(this);
-				onEndCondition(condition->getType());
-				delete condition;
-			}
+		// non periodic conditions have nothing to do until their end time has passed
+		if (!condition->isPeriodic() && condition->getEndTime() >= timeNow) {
+			continue;
+		}
+
+		// the condition may have been removed by its own execution
+		if (!condition->executeCondition(this, interval) && conditions.slot(i) == condition) {
+			conditions.erase(conditions.slotIterator(i));
+			condition->endCondition(this);
+			onEndCondition(condition->getType());
+			delete condition;
 		}
 	}
+	conditions.endDeferredErase();
 }
 
 bool Creature::hasCondition(ConditionType_t type, uint32_t subId /* = 0*/) const
@@ -1673,19 +1680,11 @@ bool Creature::getPathTo(const Position& targetPos, std::vector<Direction>& dirL
 void Creature::setStorageValue(uint32_t key, std::optional<int64_t> value, bool isSpawn)
 {
 	auto oldValue = getStorageValue(key);
-	if (value) {
-		storageMap.insert_or_assign(key, value.value());
-	} else {
-		storageMap.erase(key);
+	// storages loaded from the database are already saved
+	storageMap.set(key, value, !isSpawn);
+	if (g_events->hasHook(EventHook::CREATURE_ONUPDATESTORAGE)) {
+		g_events->eventCreatureOnUpdateStorage(this, key, oldValue, value, isSpawn);
 	}
-	g_events->eventCreatureOnUpdateStorage(this, key, oldValue, value, isSpawn);
 }
 
-std::optional<int64_t> Creature::getStorageValue(uint32_t key) const
-{
-	auto it = storageMap.find(key);
-	if (it == storageMap.end()) {
-		return std::nullopt;
-	}
-	return std::make_optional(it->second);
-}
+std::optional<int64_t> Creature::getStorageValue(uint32_t key) const { return storageMap.get(key); }
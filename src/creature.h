@@ -10,9 +10,97 @@
 #include "enums.h"
 #include "map.h"
 #include "position.h"
+#include "storagemap.h"
 #include "tile.h"
 
-using ConditionList = std::list<Condition*>;
+// Conditions of a creature, stored inline since most creatures have at most a few of them. While the conditions are
+// being executed, erasing only clears the slot and the list is compacted afterwards, so the executing loop can keep
+// going by index when a condition callback adds or removes conditions.
+class ConditionList
+{
+	using Storage = boost::container::small_vector<Condition*, 4>;
+
+public:
+	class iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Condition*;
+		using difference_type = std::ptrdiff_t;
+		using pointer = Condition* const*;
+		using reference = Condition* const&;
+
+		iterator(const Storage& storage, size_t index) : storage(&storage), index(index) { skipEmpty(); }
+
+		reference operator*() const { return (*storage)[index]; }
+		iterator& operator++()
+		{
+			++index;
+			skipEmpty();
+			return *this;
+		}
+		iterator operator++(int)
+		{
+			iterator it = *this;
+			++*this;
+			return it;
+		}
+
+		// any iterator past the last slot equals end(), erasing does not invalidate a previously taken end()
+		bool operator==(const iterator& other) const
+		{
+			return index == other.index || (index >= storage->size() && other.index >= storage->size());
+		}
+
+	private:
+		void skipEmpty()
+		{
+			while (index < storage->size() && !(*storage)[index]) {
+				++index;
+			}
+		}
+
+		const Storage* storage;
+		size_t index;
+
+		friend class ConditionList;
+	};
+	using const_iterator = iterator;
+
+	iterator begin() const { return {storage, 0}; }
+	iterator end() const { return {storage, storage.size()}; }
+	bool empty() const { return begin() == end(); }
+
+	void push_back(Condition* condition) { storage.push_back(condition); }
+
+	iterator erase(iterator it)
+	{
+		if (deferErase) {
+			storage[it.index] = nullptr;
+			return ++it;
+		}
+
+		storage.erase(storage.begin() + it.index);
+		return {storage, it.index};
+	}
+
+	// slot access for the executing loop, slots of erased conditions are nullptr until endDeferredErase
+	size_t slotCount() const { return storage.size(); }
+	Condition* slot(size_t index) const { return storage[index]; }
+	iterator slotIterator(size_t index) const { return {storage, index}; }
+
+	void beginDeferredErase() { deferErase = true; }
+	void endDeferredErase()
+	{
+		deferErase = false;
+		storage.erase(std::remove(storage.begin(), storage.end(), nullptr), storage.end());
+	}
+
+private:
+	Storage storage;
+	bool deferErase = false;
+};
+
 using CreatureEventList = std::list<CreatureEvent*>;
 
 enum slots_t : uint8_t
@@ -343,7 +431,9 @@ public:
 
 	virtual void setStorageValue(uint32_t key, std::optional<int64_t> value, bool isSpawn = false);
 	virtual std::optional<int64_t> getStorageValue(uint32_t key) const;
-	decltype(auto) getStorageMap() const { return storageMap; }
+	const StorageMap& getStorageMap() const { return storageMap; }
+	// called once the changed storages were written to the database
+	void clearDirtyStorages() { storageMap.clearDirty(); }
 
 	// for lua module
 	CreatureEventList getCreatureEvents(CreatureEventType_t type) const;
@@ -453,7 +543,7 @@ protected:
 	friend class LuaScriptInterface;
 
 private:
-	std::map<uint32_t, int64_t> storageMap;
+	StorageMap storageMap;
 };
 
 #endif
@@ -311,8 +311,7 @@ bool CreatureEvent::executeOnThink(Creature* creature, uint32_t interval)
 	lua_State* L = scriptInterface->getLuaState();
 
 	scriptInterface->pushFunction(scriptId);
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 	lua_pushinteger(L, interval);
 
 	return scriptInterface->callFunction(2);
@@ -333,12 +332,10 @@ bool CreatureEvent::executeOnPrepareDeath(Creature* creature, Creature* killer)
 
 	scriptInterface->pushFunction(scriptId);
 
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 
 	if (killer) {
-		Lua::pushUserdata<Creature>(L, killer);
-		Lua::setCreatureMetatable(L, -1, killer);
+		Lua::pushCreature(L, killer);
 	} else {
 		lua_pushnil(L);
 	}
@@ -361,21 +358,18 @@ bool CreatureEvent::executeOnDeath(Creature* creature, Item* corpse, Creature* k
 	lua_State* L = scriptInterface->getLuaState();
 
 	scriptInterface->pushFunction(scriptId);
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 
 	Lua::pushThing(L, corpse);
 
 	if (killer) {
-		Lua::pushUserdata<Creature>(L, killer);
-		Lua::setCreatureMetatable(L, -1, killer);
+		Lua::pushCreature(L, killer);
 	} else {
 		lua_pushnil(L);
 	}
 
 	if (mostDamageKiller) {
-		Lua::pushUserdata<Creature>(L, mostDamageKiller);
-		Lua::setCreatureMetatable(L, -1, mostDamageKiller);
+		Lua::pushCreature(L, mostDamageKiller);
 	} else {
 		lua_pushnil(L);
 	}
@@ -423,10 +417,8 @@ void CreatureEvent::executeOnKill(Creature* creature, Creature* target)
 	lua_State* L = scriptInterface->getLuaState();
 
 	scriptInterface->pushFunction(scriptId);
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
-	Lua::pushUserdata<Creature>(L, target);
-	Lua::setCreatureMetatable(L, -1, target);
+	Lua::pushCreature(L, creature);
+	Lua::pushCreature(L, target);
 	scriptInterface->callVoidFunction(2);
 }
 
@@ -575,8 +567,7 @@ void CreatureEvent::executeExtendedOpcode(Player* player, uint8_t opcode, std::s
 
 	scriptInterface->pushFunction(scriptId);
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	lua_pushinteger(L, opcode);
 	Lua::pushString(L, buffer);
@@ -0,0 +1,143 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#ifndef FS_CREATUREREGISTRY_H
+#define FS_CREATUREREGISTRY_H
+
+// Slot map resolving creature ids of one kind (players, monsters or npcs). An id is Base plus the slot index in the
+// low IndexBits and the slot generation above them, so a lookup is an array index and a generation compare.
+//
+// A slot is reserved when the creature gets its id and released when the creature is destroyed, which bumps the
+// generation: ids held by scheduled tasks after that no longer resolve. A slot that used its last generation is retired
+// instead of wrapping around, so like the counters it replaces, the registry never hands out an id twice; it runs out
+// after 2^(IndexBits + GenerationBits) ids. Freed slots are reused oldest first.
+template <typename T, uint32_t Base, uint32_t IndexBits, uint32_t GenerationBits>
+class CreatureRegistry
+{
+	static_assert(Base > 0 && IndexBits + GenerationBits < 32);
+	static_assert(Base - 1 + (uint64_t{1} << (IndexBits + GenerationBits)) <= std::numeric_limits<uint32_t>::max());
+
+	static constexpr uint32_t indexMask = (1u << IndexBits) - 1;
+	static constexpr uint32_t generationMask = (1u << GenerationBits) - 1;
+
+	struct Slot
+	{
+		T* creature = nullptr;
+		uint32_t generation = 0;
+		bool reserved = false;
+	};
+
+public:
+	static constexpr bool contains(uint32_t id)
+	{
+		return id >= Base && id - Base <= ((generationMask << IndexBits) | indexMask);
+	}
+
+	// returns 0 if every slot is taken
+	uint32_t reserve()
+	{
+		uint32_t index;
+		if (!freeSlots.empty()) {
+			index = freeSlots.front();
+			freeSlots.pop_front();
+		} else if (slots.size() <= indexMask) {
+			index = static_cast<uint32_t>(slots.size());
+			slots.emplace_back();
+		} else {
+			return 0;
+		}
+
+		Slot& slot = slots[index];
+		slot.reserved = true;
+		return Base + ((slot.generation << IndexBits) | index);
+	}
+
+	void release(uint32_t id)
+	{
+		Slot* slot = getSlot(id);
+		if (!slot) {
+			return;
+		}
+
+		if (slot->creature) {
+			--count;
+		}
+
+		slot->creature = nullptr;
+		slot->reserved = false;
+		if (slot->generation == generationMask) {
+			// every id of this slot was handed out, the next one would repeat the first
+			return;
+		}
+
+		++slot->generation;
+		freeSlots.push_back((id - Base) & indexMask);
+	}
+
+	// binds (or with nullptr unbinds) a reserved id to its creature, while unbound the id resolves to nullptr
+	void set(uint32_t id, T* creature)
+	{
+		Slot* slot = getSlot(id);
+		if (!slot) {
+			return;
+		}
+
+		count += (creature != nullptr) - (slot->creature != nullptr);
+		slot->creature = creature;
+	}
+
+	T* get(uint32_t id) const
+	{
+		const Slot* slot = const_cast<CreatureRegistry*>(this)->getSlot(id);
+		return slot ? slot->creature : nullptr;
+	}
+
+	size_t size() const { return count; }
+
+	template <typename Func>
+	void forEach(Func&& func) const
+	{
+		for (const Slot& slot : slots) {
+			if (slot.creature) {
+				func(slot.creature);
+			}
+		}
+	}
+
+	template <typename Predicate>
+	T* findIf(Predicate&& predicate) const
+	{
+		for (const Slot& slot : slots) {
+			if (slot.creature && predicate(*slot.creature)) {
+				return slot.creature;
+			}
+		}
+		return nullptr;
+	}
+
+private:
+	Slot* getSlot(uint32_t id)
+	{
+		if (!contains(id)) {
+			return nullptr;
+		}
+
+		uint32_t offset = id - Base;
+		uint32_t index = offset & indexMask;
+		if (index >= slots.size()) {
+			return nullptr;
+		}
+
+		Slot& slot = slots[index];
+		if (!slot.reserved || slot.generation != (offset >> IndexBits)) {
+			return nullptr;
+		}
+		return &slot;
+	}
+
+	std::vector<Slot> slots;
+	std::deque<uint32_t> freeSlots;
+	size_t count = 0;
+};
+
+#endif // FS_CREATUREREGISTRY_H
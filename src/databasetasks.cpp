@@ -51,8 +51,30 @@ void DatabaseTasks::addTask(std::string query, std::function<void(DBResult_ptr,
 	}
 }
 
+bool DatabaseTasks::addJob(std::function<void(Database&)> job)
+{
+	bool signal = false;
+	taskLock.lock();
+	bool running = getState() == THREAD_STATE_RUNNING;
+	if (running) {
+		signal = tasks.empty();
+		tasks.emplace_back(std::move(job));
+	}
+	taskLock.unlock();
+
+	if (signal) {
+		taskSignal.notify_one();
+	}
+	return running;
+}
+
 void DatabaseTasks::runTask(const DatabaseTask& task)
 {
+	if (task.job) {
+		task.job(db);
+		return;
+	}
+
 	bool success;
 	DBResult_ptr result;
 	if (task.store) {
@@ -15,10 +15,13 @@ struct DatabaseTask
 	DatabaseTask(std::string_view query, std::function<void(DBResult_ptr, bool)>&& callback, bool store) :
 	    query{query}, callback{std::move(callback)}, store{store}
 	{}
+	explicit DatabaseTask(std::function<void(Database&)>&& job) : job{std::move(job)} {}
 
 	std::string query;
 	std::function<void(DBResult_ptr, bool)> callback;
-	bool store;
+	bool store = false;
+	// runs instead of query, for work that needs several queries on the database thread
+	std::function<void(Database&)> job;
 };
 
 class DatabaseTasks : public ThreadHolder<DatabaseTasks>
@@ -30,6 +33,9 @@ public:
 	void shutdown();
 
 	void addTask(std::string query, std::function<void(DBResult_ptr, bool)> callback = nullptr, bool store = false);
+	// job runs on the database thread with its connection, it has to hand results back to the dispatcher itself;
+	// returns false when the thread is not running and the job was dropped
+	bool addJob(std::function<void(Database&)> job);
 
 	void threadMain();
 
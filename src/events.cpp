@@ -6,9 +6,73 @@
 #include "events.h"
 
 #include "item.h"
+#include "monster.h"
 #include "player.h"
 
-Events::Events() : scriptInterface("Event Interface") { scriptInterface.initState(); }
+namespace {
+
+struct EventHookInfo
+{
+	std::string_view className;
+	std::string_view methodName;
+};
+
+// class and method of each hook, in the order of EventHook
+constexpr std::array<EventHookInfo, static_cast<size_t>(EventHook::LAST)> hookInfos{{
+	// Creature
+	{"Creature", "onChangeOutfit"},
+	{"Creature", "onAreaCombat"},
+	{"Creature", "onTargetCombat"},
+	{"Creature", "onHear"},
+	{"Creature", "onChangeZone"},
+	{"Creature", "onUpdateStorage"},
+
+	// Party
+	{"Party", "onJoin"},
+	{"Party", "onLeave"},
+	{"Party", "onDisband"},
+	{"Party", "onShareExperience"},
+	{"Party", "onInvite"},
+	{"Party", "onRevokeInvitation"},
+	{"Party", "onPassLeadership"},
+
+	// Player
+	{"Player", "onLook"},
+	{"Player", "onLookInBattleList"},
+	{"Player", "onLookInTrade"},
+	{"Player", "onLookInShop"},
+	{"Player", "onMoveItem"},
+	{"Player", "onItemMoved"},
+	{"Player", "onMoveCreature"},
+	{"Player", "onStepTile"},
+	{"Player", "onReportRuleViolation"},
+	{"Player", "onReportBug"},
+	{"Player", "onTurn"},
+	{"Player", "onTradeRequest"},
+	{"Player", "onTradeAccept"},
+	{"Player", "onTradeCompleted"},
+	{"Player", "onGainExperience"},
+	{"Player", "onLoseExperience"},
+	{"Player", "onGainSkillTries"},
+	{"Player", "onNetworkMessage"},
+	{"Player", "onUpdateInventory"},
+	{"Player", "onRotateItem"},
+	{"Player", "onSpellCheck"},
+
+	// Monster
+	{"Monster", "onDropLoot"},
+	{"Monster", "onSpawn"},
+}};
+
+constexpr uint64_t getHookBit(size_t hook) { return uint64_t{1} << hook; }
+
+} // namespace
+
+Events::Events() : scriptInterface("Event Interface")
+{
+	scriptInterface.initState();
+	scriptIds.fill(-1);
+}
 
 bool Events::load()
 {
@@ -19,7 +83,8 @@ bool Events::load()
 		return false;
 	}
 
-	info = {};
+	scriptIds.fill(-1);
+	callbacksOnlyHooks = 0;
 
 	std::set<std::string> classes;
 	for (auto& eventNode : doc.child("events").children()) {
@@ -37,108 +102,67 @@ bool Events::load()
 			}
 		}
 
-		const std::string& methodName = eventNode.attribute("method").as_string();
-		const int32_t event = scriptInterface.getMetaEvent(className, methodName);
-		if (className == "Creature") {
-			if (methodName == "onChangeOutfit") {
-				info.creatureOnChangeOutfit = event;
-			} else if (methodName == "onAreaCombat") {
-				info.creatureOnAreaCombat = event;
-			} else if (methodName == "onTargetCombat") {
-				info.creatureOnTargetCombat = event;
-			} else if (methodName == "onHear") {
-				info.creatureOnHear = event;
-			} else if (methodName == "onChangeZone") {
-				info.creatureOnChangeZone = event;
-			} else if (methodName == "onUpdateStorage") {
-				info.creatureOnUpdateStorage = event;
-			} else {
-				std::cout << "[Warning - Events::load] Unknown creature method: " << methodName << std::endl;
-			}
-		} else if (className == "Party") {
-			if (methodName == "onJoin") {
-				info.partyOnJoin = event;
-			} else if (methodName == "onLeave") {
-				info.partyOnLeave = event;
-			} else if (methodName == "onDisband") {
-				info.partyOnDisband = event;
-			} else if (methodName == "onShareExperience") {
-				info.partyOnShareExperience = event;
-			} else if (methodName == "onInvite") {
-				info.partyOnInvite = event;
-			} else if (methodName == "onRevokeInvitation") {
-				info.partyOnRevokeInvitation = event;
-			} else if (methodName == "onPassLeadership") {
-				info.partyOnPassLeadership = event;
-			} else {
-				std::cout << "[Warning - Events::load] Unknown party method: " << methodName << std::endl;
-			}
-		} else if (className == "Player") {
-			if (methodName == "onLook") {
-				info.playerOnLook = event;
-			} else if (methodName == "onLookInBattleList") {
-				info.playerOnLookInBattleList = event;
-			} else if (methodName == "onLookInTrade") {
-				info.playerOnLookInTrade = event;
-			} else if (methodName == "onLookInShop") {
-				info.playerOnLookInShop = event;
-			} else if (methodName == "onTradeRequest") {
-				info.playerOnTradeRequest = event;
-			} else if (methodName == "onTradeAccept") {
-				info.playerOnTradeAccept = event;
-			} else if (methodName == "onTradeCompleted") {
-				info.playerOnTradeCompleted = event;
-			} else if (methodName == "onMoveItem") {
-				info.playerOnMoveItem = event;
-			} else if (methodName == "onItemMoved") {
-				info.playerOnItemMoved = event;
-			} else if (methodName == "onMoveCreature") {
-				info.playerOnMoveCreature = event;
-			} else if (methodName == "onStepTile") {
-				info.playerOnStepTile = event;
-			} else if (methodName == "onReportRuleViolation") {
-				info.playerOnReportRuleViolation = event;
-			} else if (methodName == "onReportBug") {
-				info.playerOnReportBug = event;
-			} else if (methodName == "onTurn") {
-				info.playerOnTurn = event;
-			} else if (methodName == "onGainExperience") {
-				info.playerOnGainExperience = event;
-			} else if (methodName == "onLoseExperience") {
-				info.playerOnLoseExperience = event;
-			} else if (methodName == "onGainSkillTries") {
-				info.playerOnGainSkillTries = event;
-			} else if (methodName == "onNetworkMessage") {
-				info.playerOnNetworkMessage = event;
-			} else if (methodName == "onUpdateInventory") {
-				info.playerOnUpdateInventory = event;
-			} else if (methodName == "onRotateItem") {
-				info.playerOnRotateItem = event;
-			} else if (methodName == "onSpellCheck") {
-				info.playerOnSpellCheck = event;
-			} else {
-				std::cout << "[Warning - Events::load] Unknown player method: " << methodName << std::endl;
-			}
-		} else if (className == "Monster") {
-			if (methodName == "onDropLoot") {
-				info.monsterOnDropLoot = event;
-			} else if (methodName == "onSpawn") {
-				info.monsterOnSpawn = event;
-			} else {
-				std::cout << "[Warning - Events::load] Unknown monster method: " << methodName << std::endl;
-			}
-		} else {
+		if (std::none_of(hookInfos.begin(), hookInfos.end(),
+		                 [&](const EventHookInfo& hookInfo) { return hookInfo.className == className; })) {
 			std::cout << "[Warning - Events::load] Unknown class: " << className << std::endl;
+			continue;
+		}
+
+		const std::string& methodName = eventNode.attribute("method").as_string();
+		auto it = std::find_if(hookInfos.begin(), hookInfos.end(), [&](const EventHookInfo& hookInfo) {
+			return hookInfo.className == className && hookInfo.methodName == methodName;
+		});
+		if (it == hookInfos.end()) {
+			std::cout << "[Warning - Events::load] Unknown " << boost::algorithm::to_lower_copy(className)
+			          << " method: " << methodName << std::endl;
+			continue;
+		}
+
+		const size_t hook = std::distance(hookInfos.begin(), it);
+		scriptIds[hook] = scriptInterface.getMetaEvent(className, methodName);
+		if (eventNode.attribute("callbacksOnly").as_bool()) {
+			callbacksOnlyHooks |= getHookBit(hook);
 		}
 	}
+
+	updateActiveHooks();
 	return true;
 }
 
+void Events::setCallbackCount(std::string_view methodName, uint32_t count)
+{
+	auto it = callbackCounts.find(methodName);
+	if (it == callbackCounts.end()) {
+		callbackCounts.emplace(methodName, count);
+	} else {
+		it->second = count;
+	}
+	updateActiveHooks();
+}
+
+void Events::updateActiveHooks()
+{
+	activeHooks = 0;
+	for (size_t hook = 0; hook < HOOK_COUNT; ++hook) {
+		if (scriptIds[hook] == -1) {
+			continue;
+		}
+
+		if (callbacksOnlyHooks & getHookBit(hook)) {
+			auto it = callbackCounts.find(hookInfos[hook].methodName);
+			if (it == callbackCounts.end() || it->second == 0) {
+				continue;
+			}
+		}
+		activeHooks |= getHookBit(hook);
+	}
+}
+
 // Monster
 bool Events::eventMonsterOnSpawn(Monster* monster, const Position& position, bool startup, bool artificial)
 {
 	// Monster:onSpawn(position, startup, artificial)
-	if (info.monsterOnSpawn == -1) {
+	if (!hasHook(EventHook::MONSTER_ONSPAWN)) {
 		return true;
 	}
 
@@ -148,13 +172,12 @@ bool Events::eventMonsterOnSpawn(Monster* monster, const Position& position, boo
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.monsterOnSpawn, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::MONSTER_ONSPAWN), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.monsterOnSpawn);
+	scriptInterface.pushFunction(getScriptId(EventHook::MONSTER_ONSPAWN));
 
-	Lua::pushUserdata<Monster>(L, monster);
-	Lua::setMetatable(L, -1, "Monster");
+	Lua::pushCreature(L, monster);
 	Lua::pushPosition(L, position);
 	Lua::pushBoolean(L, startup);
 	Lua::pushBoolean(L, artificial);
@@ -166,7 +189,7 @@ bool Events::eventMonsterOnSpawn(Monster* monster, const Position& position, boo
 bool Events::eventCreatureOnChangeOutfit(Creature* creature, const Outfit_t& outfit)
 {
 	// Creature:onChangeOutfit(outfit) or Creature.onChangeOutfit(self, outfit)
-	if (info.creatureOnChangeOutfit == -1) {
+	if (!hasHook(EventHook::CREATURE_ONCHANGEOUTFIT)) {
 		return true;
 	}
 
@@ -176,13 +199,12 @@ bool Events::eventCreatureOnChangeOutfit(Creature* creature, const Outfit_t& out
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.creatureOnChangeOutfit, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::CREATURE_ONCHANGEOUTFIT), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.creatureOnChangeOutfit);
+	scriptInterface.pushFunction(getScriptId(EventHook::CREATURE_ONCHANGEOUTFIT));
 
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 
 	Lua::pushOutfit(L, outfit);
 
@@ -192,7 +214,7 @@ bool Events::eventCreatureOnChangeOutfit(Creature* creature, const Outfit_t& out
 ReturnValue Events::eventCreatureOnAreaCombat(Creature* creature, Tile* tile, bool aggressive)
 {
 	// Creature:onAreaCombat(tile, aggressive) or Creature.onAreaCombat(self, tile, aggressive)
-	if (info.creatureOnAreaCombat == -1) {
+	if (!hasHook(EventHook::CREATURE_ONAREACOMBAT)) {
 		return RETURNVALUE_NOERROR;
 	}
 
@@ -202,14 +224,13 @@ ReturnValue Events::eventCreatureOnAreaCombat(Creature* creature, Tile* tile, bo
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.creatureOnAreaCombat, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::CREATURE_ONAREACOMBAT), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.creatureOnAreaCombat);
+	scriptInterface.pushFunction(getScriptId(EventHook::CREATURE_ONAREACOMBAT));
 
 	if (creature) {
-		Lua::pushUserdata<Creature>(L, creature);
-		Lua::setCreatureMetatable(L, -1, creature);
+		Lua::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -235,7 +256,7 @@ ReturnValue Events::eventCreatureOnAreaCombat(Creature* creature, Tile* tile, bo
 ReturnValue Events::eventCreatureOnTargetCombat(Creature* creature, Creature* target)
 {
 	// Creature:onTargetCombat(target) or Creature.onTargetCombat(self, target)
-	if (info.creatureOnTargetCombat == -1) {
+	if (!hasHook(EventHook::CREATURE_ONTARGETCOMBAT)) {
 		return RETURNVALUE_NOERROR;
 	}
 
@@ -245,20 +266,18 @@ ReturnValue Events::eventCreatureOnTargetCombat(Creature* creature, Creature* ta
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.creatureOnTargetCombat, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::CREATURE_ONTARGETCOMBAT), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.creatureOnTargetCombat);
+	scriptInterface.pushFunction(getScriptId(EventHook::CREATURE_ONTARGETCOMBAT));
 
 	if (creature) {
-		Lua::pushUserdata<Creature>(L, creature);
-		Lua::setCreatureMetatable(L, -1, creature);
+		Lua::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
 
-	Lua::pushUserdata<Creature>(L, target);
-	Lua::setCreatureMetatable(L, -1, target);
+	Lua::pushCreature(L, target);
 
 	ReturnValue returnValue;
 	if (scriptInterface.protectedCall(L, 2, 1) != 0) {
@@ -276,7 +295,7 @@ ReturnValue Events::eventCreatureOnTargetCombat(Creature* creature, Creature* ta
 void Events::eventCreatureOnHear(Creature* creature, Creature* speaker, std::string_view words, SpeakClasses type)
 {
 	// Creature:onHear(speaker, words, type)
-	if (info.creatureOnHear == -1) {
+	if (!hasHook(EventHook::CREATURE_ONHEAR)) {
 		return;
 	}
 
@@ -286,16 +305,14 @@ void Events::eventCreatureOnHear(Creature* creature, Creature* speaker, std::str
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.creatureOnHear, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::CREATURE_ONHEAR), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.creatureOnHear);
+	scriptInterface.pushFunction(getScriptId(EventHook::CREATURE_ONHEAR));
 
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 
-	Lua::pushUserdata<Creature>(L, speaker);
-	Lua::setCreatureMetatable(L, -1, speaker);
+	Lua::pushCreature(L, speaker);
 
 	Lua::pushString(L, words);
 	lua_pushinteger(L, type);
@@ -306,7 +323,7 @@ void Events::eventCreatureOnHear(Creature* creature, Creature* speaker, std::str
 void Events::eventCreatureOnChangeZone(Creature* creature, ZoneType_t fromZone, ZoneType_t toZone)
 {
 	// Creature:onChangeZone(fromZone, toZone)
-	if (info.creatureOnChangeZone == -1) {
+	if (!hasHook(EventHook::CREATURE_ONCHANGEZONE)) {
 		return;
 	}
 
@@ -316,13 +333,12 @@ void Events::eventCreatureOnChangeZone(Creature* creature, ZoneType_t fromZone,
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.creatureOnChangeZone, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::CREATURE_ONCHANGEZONE), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.creatureOnChangeZone);
+	scriptInterface.pushFunction(getScriptId(EventHook::CREATURE_ONCHANGEZONE));
 
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 
 	lua_pushinteger(L, fromZone);
 	lua_pushinteger(L, toZone);
@@ -334,7 +350,7 @@ void Events::eventCreatureOnUpdateStorage(Creature* creature, const uint32_t key
                                           const std::optional<int32_t> oldValue, bool isSpawn)
 {
 	// Creature:onUpdateStorage(key, value, oldValue, isSpawn)
-	if (info.creatureOnUpdateStorage == -1) {
+	if (!hasHook(EventHook::CREATURE_ONUPDATESTORAGE)) {
 		return;
 	}
 
@@ -344,10 +360,10 @@ void Events::eventCreatureOnUpdateStorage(Creature* creature, const uint32_t key
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.creatureOnUpdateStorage, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::CREATURE_ONUPDATESTORAGE), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.creatureOnUpdateStorage);
+	scriptInterface.pushFunction(getScriptId(EventHook::CREATURE_ONUPDATESTORAGE));
 
 	Lua::pushUserdata<Creature>(L, creature);
 	Lua::setMetatable(L, -1, "Creature");
@@ -374,7 +390,7 @@ void Events::eventCreatureOnUpdateStorage(Creature* creature, const uint32_t key
 bool Events::eventPartyOnJoin(Party* party, Player* player)
 {
 	// Party:onJoin(player) or Party.onJoin(self, player)
-	if (info.partyOnJoin == -1) {
+	if (!hasHook(EventHook::PARTY_ONJOIN)) {
 		return true;
 	}
 
@@ -384,16 +400,15 @@ bool Events::eventPartyOnJoin(Party* party, Player* player)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.partyOnJoin, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PARTY_ONJOIN), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.partyOnJoin);
+	scriptInterface.pushFunction(getScriptId(EventHook::PARTY_ONJOIN));
 
 	Lua::pushUserdata<Party>(L, party);
 	Lua::setMetatable(L, -1, "Party");
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	return scriptInterface.callFunction(2);
 }
@@ -401,7 +416,7 @@ bool Events::eventPartyOnJoin(Party* party, Player* player)
 bool Events::eventPartyOnLeave(Party* party, Player* player)
 {
 	// Party:onLeave(player) or Party.onLeave(self, player)
-	if (info.partyOnLeave == -1) {
+	if (!hasHook(EventHook::PARTY_ONLEAVE)) {
 		return true;
 	}
 
@@ -411,16 +426,15 @@ bool Events::eventPartyOnLeave(Party* party, Player* player)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.partyOnLeave, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PARTY_ONLEAVE), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.partyOnLeave);
+	scriptInterface.pushFunction(getScriptId(EventHook::PARTY_ONLEAVE));
 
 	Lua::pushUserdata<Party>(L, party);
 	Lua::setMetatable(L, -1, "Party");
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	return scriptInterface.callFunction(2);
 }
@@ -428,7 +442,7 @@ bool Events::eventPartyOnLeave(Party* party, Player* player)
 bool Events::eventPartyOnDisband(Party* party)
 {
 	// Party:onDisband() or Party.onDisband(self)
-	if (info.partyOnDisband == -1) {
+	if (!hasHook(EventHook::PARTY_ONDISBAND)) {
 		return true;
 	}
 
@@ -438,10 +452,10 @@ bool Events::eventPartyOnDisband(Party* party)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.partyOnDisband, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PARTY_ONDISBAND), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.partyOnDisband);
+	scriptInterface.pushFunction(getScriptId(EventHook::PARTY_ONDISBAND));
 
 	Lua::pushUserdata<Party>(L, party);
 	Lua::setMetatable(L, -1, "Party");
@@ -452,7 +466,7 @@ bool Events::eventPartyOnDisband(Party* party)
 void Events::eventPartyOnShareExperience(Party* party, uint64_t& exp)
 {
 	// Party:onShareExperience(exp) or Party.onShareExperience(self, exp)
-	if (info.partyOnShareExperience == -1) {
+	if (!hasHook(EventHook::PARTY_ONSHAREEXPERIENCE)) {
 		return;
 	}
 
@@ -462,10 +476,10 @@ void Events::eventPartyOnShareExperience(Party* party, uint64_t& exp)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.partyOnShareExperience, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PARTY_ONSHAREEXPERIENCE), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.partyOnShareExperience);
+	scriptInterface.pushFunction(getScriptId(EventHook::PARTY_ONSHAREEXPERIENCE));
 
 	Lua::pushUserdata<Party>(L, party);
 	Lua::setMetatable(L, -1, "Party");
@@ -485,7 +499,7 @@ void Events::eventPartyOnShareExperience(Party* party, uint64_t& exp)
 bool Events::eventPartyOnInvite(Party* party, Player* player)
 {
 	// Party:onInvite(player) or Party.onInvite(self, player)
-	if (info.partyOnInvite == -1) {
+	if (!hasHook(EventHook::PARTY_ONINVITE)) {
 		return true;
 	}
 
@@ -495,16 +509,15 @@ bool Events::eventPartyOnInvite(Party* party, Player* player)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.partyOnInvite, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PARTY_ONINVITE), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.partyOnInvite);
+	scriptInterface.pushFunction(getScriptId(EventHook::PARTY_ONINVITE));
 
 	Lua::pushUserdata<Party>(L, party);
 	Lua::setMetatable(L, -1, "Party");
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	return scriptInterface.callFunction(2);
 }
@@ -512,7 +525,7 @@ bool Events::eventPartyOnInvite(Party* party, Player* player)
 bool Events::eventPartyOnRevokeInvitation(Party* party, Player* player)
 {
 	// Party:onRevokeInvitation(player) or Party.onRevokeInvitation(self, player)
-	if (info.partyOnRevokeInvitation == -1) {
+	if (!hasHook(EventHook::PARTY_ONREVOKEINVITATION)) {
 		return true;
 	}
 
@@ -522,16 +535,15 @@ bool Events::eventPartyOnRevokeInvitation(Party* party, Player* player)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.partyOnRevokeInvitation, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PARTY_ONREVOKEINVITATION), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.partyOnRevokeInvitation);
+	scriptInterface.pushFunction(getScriptId(EventHook::PARTY_ONREVOKEINVITATION));
 
 	Lua::pushUserdata<Party>(L, party);
 	Lua::setMetatable(L, -1, "Party");
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	return scriptInterface.callFunction(2);
 }
@@ -539,7 +551,7 @@ bool Events::eventPartyOnRevokeInvitation(Party* party, Player* player)
 bool Events::eventPartyOnPassLeadership(Party* party, Player* player)
 {
 	// Party:onPassLeadership(player) or Party.onPassLeadership(self, player)
-	if (info.partyOnPassLeadership == -1) {
+	if (!hasHook(EventHook::PARTY_ONPASSLEADERSHIP)) {
 		return true;
 	}
 
@@ -549,16 +561,15 @@ bool Events::eventPartyOnPassLeadership(Party* party, Player* player)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.partyOnPassLeadership, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PARTY_ONPASSLEADERSHIP), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.partyOnPassLeadership);
+	scriptInterface.pushFunction(getScriptId(EventHook::PARTY_ONPASSLEADERSHIP));
 
 	Lua::pushUserdata<Party>(L, party);
 	Lua::setMetatable(L, -1, "Party");
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	return scriptInterface.callFunction(2);
 }
@@ -568,7 +579,7 @@ void Events::eventPlayerOnLook(Player* player, const Position& position, Thing*
                                int32_t lookDistance)
 {
 	// Player:onLook(thing, position, distance) or Player.onLook(self, thing, position, distance)
-	if (info.playerOnLook == -1) {
+	if (!hasHook(EventHook::PLAYER_ONLOOK)) {
 		return;
 	}
 
@@ -578,17 +589,15 @@ void Events::eventPlayerOnLook(Player* player, const Position& position, Thing*
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnLook, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONLOOK), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnLook);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONLOOK));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	if (Creature* creature = thing->getCreature()) {
-		Lua::pushUserdata<Creature>(L, creature);
-		Lua::setCreatureMetatable(L, -1, creature);
+		Lua::pushCreature(L, creature);
 	} else if (Item* item = thing->getItem()) {
 		Lua::pushUserdata<Item>(L, item);
 		Lua::setItemMetatable(L, -1, item);
@@ -605,7 +614,7 @@ void Events::eventPlayerOnLook(Player* player, const Position& position, Thing*
 void Events::eventPlayerOnLookInBattleList(Player* player, Creature* creature, int32_t lookDistance)
 {
 	// Player:onLookInBattleList(creature, distance) or Player.onLookInBattleList(self, creature, distance)
-	if (info.playerOnLookInBattleList == -1) {
+	if (!hasHook(EventHook::PLAYER_ONLOOKINBATTLELIST)) {
 		return;
 	}
 
@@ -615,16 +624,14 @@ void Events::eventPlayerOnLookInBattleList(Player* player, Creature* creature, i
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnLookInBattleList, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONLOOKINBATTLELIST), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnLookInBattleList);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONLOOKINBATTLELIST));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 
 	lua_pushinteger(L, lookDistance);
 
@@ -634,7 +641,7 @@ void Events::eventPlayerOnLookInBattleList(Player* player, Creature* creature, i
 void Events::eventPlayerOnLookInTrade(Player* player, Player* partner, Item* item, int32_t lookDistance)
 {
 	// Player:onLookInTrade(partner, item, distance) or Player.onLookInTrade(self, partner, item, distance)
-	if (info.playerOnLookInTrade == -1) {
+	if (!hasHook(EventHook::PLAYER_ONLOOKINTRADE)) {
 		return;
 	}
 
@@ -644,16 +651,14 @@ void Events::eventPlayerOnLookInTrade(Player* player, Player* partner, Item* ite
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnLookInTrade, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONLOOKINTRADE), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnLookInTrade);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONLOOKINTRADE));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
-	Lua::pushUserdata<Player>(L, partner);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, partner);
 
 	Lua::pushUserdata<Item>(L, item);
 	Lua::setItemMetatable(L, -1, item);
@@ -666,7 +671,7 @@ void Events::eventPlayerOnLookInTrade(Player* player, Player* partner, Item* ite
 bool Events::eventPlayerOnLookInShop(Player* player, const ItemType* itemType, uint8_t count)
 {
 	// Player:onLookInShop(itemType, count) or Player.onLookInShop(self, itemType, count)
-	if (info.playerOnLookInShop == -1) {
+	if (!hasHook(EventHook::PLAYER_ONLOOKINSHOP)) {
 		return true;
 	}
 
@@ -676,13 +681,12 @@ bool Events::eventPlayerOnLookInShop(Player* player, const ItemType* itemType, u
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnLookInShop, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONLOOKINSHOP), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnLookInShop);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONLOOKINSHOP));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	Lua::pushUserdata<const ItemType>(L, itemType);
 	Lua::setMetatable(L, -1, "ItemType");
@@ -697,7 +701,7 @@ ReturnValue Events::eventPlayerOnMoveItem(Player* player, Item* item, uint16_t c
 {
 	// Player:onMoveItem(item, count, fromPosition, toPosition) or Player.onMoveItem(self, item, count, fromPosition,
 	// toPosition, fromCylinder, toCylinder)
-	if (info.playerOnMoveItem == -1) {
+	if (!hasHook(EventHook::PLAYER_ONMOVEITEM)) {
 		return RETURNVALUE_NOERROR;
 	}
 
@@ -707,13 +711,12 @@ ReturnValue Events::eventPlayerOnMoveItem(Player* player, Item* item, uint16_t c
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnMoveItem, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONMOVEITEM), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnMoveItem);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONMOVEITEM));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	Lua::pushUserdata<Item>(L, item);
 	Lua::setItemMetatable(L, -1, item);
@@ -743,7 +746,7 @@ void Events::eventPlayerOnItemMoved(Player* player, Item* item, uint16_t count,
 {
 	// Player:onItemMoved(item, count, fromPosition, toPosition) or Player.onItemMoved(self, item, count, fromPosition,
 	// toPosition, fromCylinder, toCylinder)
-	if (info.playerOnItemMoved == -1) {
+	if (!hasHook(EventHook::PLAYER_ONITEMMOVED)) {
 		return;
 	}
 
@@ -753,13 +756,12 @@ void Events::eventPlayerOnItemMoved(Player* player, Item* item, uint16_t count,
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnItemMoved, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONITEMMOVED), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnItemMoved);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONITEMMOVED));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	Lua::pushUserdata<Item>(L, item);
 	Lua::setItemMetatable(L, -1, item);
@@ -779,7 +781,7 @@ bool Events::eventPlayerOnMoveCreature(Player* player, Creature* creature, const
 {
 	// Player:onMoveCreature(creature, fromPosition, toPosition) or Player.onMoveCreature(self, creature, fromPosition,
 	// toPosition)
-	if (info.playerOnMoveCreature == -1) {
+	if (!hasHook(EventHook::PLAYER_ONMOVECREATURE)) {
 		return true;
 	}
 
@@ -789,16 +791,14 @@ bool Events::eventPlayerOnMoveCreature(Player* player, Creature* creature, const
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnMoveCreature, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONMOVECREATURE), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnMoveCreature);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONMOVECREATURE));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 
 	Lua::pushPosition(L, fromPosition);
 	Lua::pushPosition(L, toPosition);
@@ -809,7 +809,7 @@ bool Events::eventPlayerOnMoveCreature(Player* player, Creature* creature, const
 bool Events::eventPlayerOnStepTile(Player* player, const Position& fromPosition, const Position& toPosition)
 {
 	// Player:onStepTile(fromPosition, toPosition)
-	if (info.playerOnStepTile == -1) {
+	if (!hasHook(EventHook::PLAYER_ONSTEPTILE)) {
 		return true;
 	}
 
@@ -819,13 +819,12 @@ bool Events::eventPlayerOnStepTile(Player* player, const Position& fromPosition,
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnStepTile, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONSTEPTILE), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnStepTile);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONSTEPTILE));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 	Lua::pushPosition(L, fromPosition);
 	Lua::pushPosition(L, toPosition);
 
@@ -837,7 +836,7 @@ void Events::eventPlayerOnReportRuleViolation(Player* player, std::string_view t
                                               std::string_view translation)
 {
 	// Player:onReportRuleViolation(targetName, reportType, reportReason, comment, translation)
-	if (info.playerOnReportRuleViolation == -1) {
+	if (!hasHook(EventHook::PLAYER_ONREPORTRULEVIOLATION)) {
 		return;
 	}
 
@@ -847,13 +846,12 @@ void Events::eventPlayerOnReportRuleViolation(Player* player, std::string_view t
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnReportRuleViolation, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONREPORTRULEVIOLATION), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnReportRuleViolation);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONREPORTRULEVIOLATION));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	Lua::pushString(L, targetName);
 
@@ -869,7 +867,7 @@ void Events::eventPlayerOnReportRuleViolation(Player* player, std::string_view t
 bool Events::eventPlayerOnReportBug(Player* player, std::string_view message)
 {
 	// Player:onReportBug(message)
-	if (info.playerOnReportBug == -1) {
+	if (!hasHook(EventHook::PLAYER_ONREPORTBUG)) {
 		return true;
 	}
 
@@ -879,13 +877,12 @@ bool Events::eventPlayerOnReportBug(Player* player, std::string_view message)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnReportBug, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONREPORTBUG), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnReportBug);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONREPORTBUG));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	Lua::pushString(L, message);
 
@@ -895,7 +892,7 @@ bool Events::eventPlayerOnReportBug(Player* player, std::string_view message)
 bool Events::eventPlayerOnTurn(Player* player, Direction direction)
 {
 	// Player:onTurn(direction) or Player.onTurn(self, direction)
-	if (info.playerOnTurn == -1) {
+	if (!hasHook(EventHook::PLAYER_ONTURN)) {
 		return true;
 	}
 
@@ -905,13 +902,12 @@ bool Events::eventPlayerOnTurn(Player* player, Direction direction)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnTurn, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONTURN), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnTurn);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONTURN));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	lua_pushinteger(L, direction);
 
@@ -921,7 +917,7 @@ bool Events::eventPlayerOnTurn(Player* player, Direction direction)
 bool Events::eventPlayerOnTradeRequest(Player* player, Player* target, Item* item)
 {
 	// Player:onTradeRequest(target, item)
-	if (info.playerOnTradeRequest == -1) {
+	if (!hasHook(EventHook::PLAYER_ONTRADEREQUEST)) {
 		return true;
 	}
 
@@ -931,16 +927,14 @@ bool Events::eventPlayerOnTradeRequest(Player* player, Player* target, Item* ite
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnTradeRequest, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONTRADEREQUEST), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnTradeRequest);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONTRADEREQUEST));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
-	Lua::pushUserdata<Player>(L, target);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, target);
 
 	Lua::pushUserdata<Item>(L, item);
 	Lua::setItemMetatable(L, -1, item);
@@ -951,7 +945,7 @@ bool Events::eventPlayerOnTradeRequest(Player* player, Player* target, Item* ite
 bool Events::eventPlayerOnTradeAccept(Player* player, Player* target, Item* item, Item* targetItem)
 {
 	// Player:onTradeAccept(target, item, targetItem)
-	if (info.playerOnTradeAccept == -1) {
+	if (!hasHook(EventHook::PLAYER_ONTRADEACCEPT)) {
 		return true;
 	}
 
@@ -961,16 +955,14 @@ bool Events::eventPlayerOnTradeAccept(Player* player, Player* target, Item* item
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnTradeAccept, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONTRADEACCEPT), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnTradeAccept);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONTRADEACCEPT));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
-	Lua::pushUserdata<Player>(L, target);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, target);
 
 	Lua::pushUserdata<Item>(L, item);
 	Lua::setItemMetatable(L, -1, item);
@@ -984,7 +976,7 @@ bool Events::eventPlayerOnTradeAccept(Player* player, Player* target, Item* item
 void Events::eventPlayerOnTradeCompleted(Player* player, Player* target, Item* item, Item* targetItem, bool isSuccess)
 {
 	// Player:onTradeCompleted(target, item, targetItem, isSuccess)
-	if (info.playerOnTradeCompleted == -1) {
+	if (!hasHook(EventHook::PLAYER_ONTRADECOMPLETED)) {
 		return;
 	}
 
@@ -994,16 +986,14 @@ void Events::eventPlayerOnTradeCompleted(Player* player, Player* target, Item* i
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnTradeCompleted, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONTRADECOMPLETED), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnTradeCompleted);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONTRADECOMPLETED));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
-	Lua::pushUserdata<Player>(L, target);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, target);
 
 	Lua::pushUserdata<Item>(L, item);
 	Lua::setItemMetatable(L, -1, item);
@@ -1020,7 +1010,7 @@ void Events::eventPlayerOnGainExperience(Player* player, Creature* source, uint6
 {
 	// Player:onGainExperience(source, exp, rawExp)
 	// rawExp gives the original exp which is not multiplied
-	if (info.playerOnGainExperience == -1) {
+	if (!hasHook(EventHook::PLAYER_ONGAINEXPERIENCE)) {
 		return;
 	}
 
@@ -1030,17 +1020,15 @@ void Events::eventPlayerOnGainExperience(Player* player, Creature* source, uint6
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnGainExperience, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONGAINEXPERIENCE), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnGainExperience);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONGAINEXPERIENCE));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	if (source) {
-		Lua::pushUserdata<Creature>(L, source);
-		Lua::setCreatureMetatable(L, -1, source);
+		Lua::pushCreature(L, source);
 	} else {
 		lua_pushnil(L);
 	}
@@ -1061,7 +1049,7 @@ void Events::eventPlayerOnGainExperience(Player* player, Creature* source, uint6
 void Events::eventPlayerOnLoseExperience(Player* player, uint64_t& exp)
 {
 	// Player:onLoseExperience(exp)
-	if (info.playerOnLoseExperience == -1) {
+	if (!hasHook(EventHook::PLAYER_ONLOSEEXPERIENCE)) {
 		return;
 	}
 
@@ -1071,13 +1059,12 @@ void Events::eventPlayerOnLoseExperience(Player* player, uint64_t& exp)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnLoseExperience, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONLOSEEXPERIENCE), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnLoseExperience);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONLOSEEXPERIENCE));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	lua_pushinteger(L, exp);
 
@@ -1094,7 +1081,7 @@ void Events::eventPlayerOnLoseExperience(Player* player, uint64_t& exp)
 void Events::eventPlayerOnGainSkillTries(Player* player, skills_t skill, uint64_t& tries, bool artificial)
 {
 	// Player:onGainSkillTries(skill, tries, artificial)
-	if (info.playerOnGainSkillTries == -1) {
+	if (!hasHook(EventHook::PLAYER_ONGAINSKILLTRIES)) {
 		return;
 	}
 
@@ -1104,13 +1091,12 @@ void Events::eventPlayerOnGainSkillTries(Player* player, skills_t skill, uint64_
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnGainSkillTries, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONGAINSKILLTRIES), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnGainSkillTries);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONGAINSKILLTRIES));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	lua_pushinteger(L, skill);
 	lua_pushinteger(L, tries);
@@ -1130,7 +1116,7 @@ void Events::eventPlayerOnGainSkillTries(Player* player, skills_t skill, uint64_
 void Events::eventPlayerOnNetworkMessage(Player* player, uint8_t recvByte, NetworkMessage_ptr& msg)
 {
 	// Player:onNetworkMessage(recvByte, msg)
-	if (info.playerOnNetworkMessage == -1) {
+	if (!hasHook(EventHook::PLAYER_ONNETWORKMESSAGE)) {
 		return;
 	}
 
@@ -1140,13 +1126,12 @@ void Events::eventPlayerOnNetworkMessage(Player* player, uint8_t recvByte, Netwo
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnNetworkMessage, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONNETWORKMESSAGE), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnNetworkMessage);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONNETWORKMESSAGE));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	lua_pushinteger(L, recvByte);
 
@@ -1159,7 +1144,7 @@ void Events::eventPlayerOnNetworkMessage(Player* player, uint8_t recvByte, Netwo
 void Events::eventPlayerOnUpdateInventory(Player* player, Item* item, const slots_t slot, const bool equip)
 {
 	// Player:onUpdateInventory(item, slot, equip)
-	if (info.playerOnUpdateInventory == -1) {
+	if (!hasHook(EventHook::PLAYER_ONUPDATEINVENTORY)) {
 		return;
 	}
 
@@ -1169,13 +1154,12 @@ void Events::eventPlayerOnUpdateInventory(Player* player, Item* item, const slot
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnUpdateInventory, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONUPDATEINVENTORY), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnUpdateInventory);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONUPDATEINVENTORY));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	Lua::pushUserdata<Item>(L, item);
 	Lua::setItemMetatable(L, -1, item);
@@ -1189,7 +1173,7 @@ void Events::eventPlayerOnUpdateInventory(Player* player, Item* item, const slot
 void Events::eventPlayerOnRotateItem(Player* player, Item* item)
 {
 	// Player:onRotateItem(item)
-	if (info.playerOnRotateItem == -1) {
+	if (!hasHook(EventHook::PLAYER_ONROTATEITEM)) {
 		return;
 	}
 
@@ -1199,13 +1183,12 @@ void Events::eventPlayerOnRotateItem(Player* player, Item* item)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnRotateItem, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONROTATEITEM), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnRotateItem);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONROTATEITEM));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	Lua::pushUserdata<Item>(L, item);
 	Lua::setItemMetatable(L, -1, item);
@@ -1216,7 +1199,7 @@ void Events::eventPlayerOnRotateItem(Player* player, Item* item)
 bool Events::eventPlayerOnSpellCheck(Player* player, const Spell* spell)
 {
 	// Player:onSpellCheck(spell)
-	if (info.playerOnSpellCheck == -1) {
+	if (!hasHook(EventHook::PLAYER_ONSPELLCHECK)) {
 		return true;
 	}
 
@@ -1226,13 +1209,12 @@ bool Events::eventPlayerOnSpellCheck(Player* player, const Spell* spell)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.playerOnSpellCheck, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::PLAYER_ONSPELLCHECK), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.playerOnSpellCheck);
+	scriptInterface.pushFunction(getScriptId(EventHook::PLAYER_ONSPELLCHECK));
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	Lua::pushSpell(L, *spell);
 
@@ -1242,7 +1224,7 @@ bool Events::eventPlayerOnSpellCheck(Player* player, const Spell* spell)
 void Events::eventMonsterOnDropLoot(Monster* monster, Container* corpse)
 {
 	// Monster:onDropLoot(corpse)
-	if (info.monsterOnDropLoot == -1) {
+	if (!hasHook(EventHook::MONSTER_ONDROPLOOT)) {
 		return;
 	}
 
@@ -1252,13 +1234,12 @@ void Events::eventMonsterOnDropLoot(Monster* monster, Container* corpse)
 	}
 
 	ScriptEnvironment* env = scriptInterface.getScriptEnv();
-	env->setScriptId(info.monsterOnDropLoot, &scriptInterface);
+	env->setScriptId(getScriptId(EventHook::MONSTER_ONDROPLOOT), &scriptInterface);
 
 	lua_State* L = scriptInterface.getLuaState();
-	scriptInterface.pushFunction(info.monsterOnDropLoot);
+	scriptInterface.pushFunction(getScriptId(EventHook::MONSTER_ONDROPLOOT));
 
-	Lua::pushUserdata<Monster>(L, monster);
-	Lua::setMetatable(L, -1, "Monster");
+	Lua::pushCreature(L, monster);
 
 	Lua::pushUserdata<Container>(L, corpse);
 	Lua::setMetatable(L, -1, "Container");
@@ -14,63 +14,60 @@ class Party;
 class Spell;
 class Tile;
 
-enum class EventInfoId
+// The events of events.xml. An event is a hook of Events, its index is its bit in the mask of hooks that are worth
+// calling.
+enum class EventHook : uint8_t
 {
 	// Creature
+	CREATURE_ONCHANGEOUTFIT,
+	CREATURE_ONAREACOMBAT,
+	CREATURE_ONTARGETCOMBAT,
 	CREATURE_ONHEAR,
+	CREATURE_ONCHANGEZONE,
+	CREATURE_ONUPDATESTORAGE,
+
+	// Party
+	PARTY_ONJOIN,
+	PARTY_ONLEAVE,
+	PARTY_ONDISBAND,
+	PARTY_ONSHAREEXPERIENCE,
+	PARTY_ONINVITE,
+	PARTY_ONREVOKEINVITATION,
+	PARTY_ONPASSLEADERSHIP,
+
+	// Player
+	PLAYER_ONLOOK,
+	PLAYER_ONLOOKINBATTLELIST,
+	PLAYER_ONLOOKINTRADE,
+	PLAYER_ONLOOKINSHOP,
+	PLAYER_ONMOVEITEM,
+	PLAYER_ONITEMMOVED,
+	PLAYER_ONMOVECREATURE,
+	PLAYER_ONSTEPTILE,
+	PLAYER_ONREPORTRULEVIOLATION,
+	PLAYER_ONREPORTBUG,
+	PLAYER_ONTURN,
+	PLAYER_ONTRADEREQUEST,
+	PLAYER_ONTRADEACCEPT,
+	PLAYER_ONTRADECOMPLETED,
+	PLAYER_ONGAINEXPERIENCE,
+	PLAYER_ONLOSEEXPERIENCE,
+	PLAYER_ONGAINSKILLTRIES,
+	PLAYER_ONNETWORKMESSAGE,
+	PLAYER_ONUPDATEINVENTORY,
+	PLAYER_ONROTATEITEM,
+	PLAYER_ONSPELLCHECK,
 
 	// Monster
-	MONSTER_ONSPAWN
+	MONSTER_ONDROPLOOT,
+	MONSTER_ONSPAWN,
+	LAST
 };
 
 class Events
 {
-	struct EventsInfo
-	{
-		// Creature
-		int32_t creatureOnChangeOutfit = -1;
-		int32_t creatureOnAreaCombat = -1;
-		int32_t creatureOnTargetCombat = -1;
-		int32_t creatureOnHear = -1;
-		int32_t creatureOnChangeZone = -1;
-		int32_t creatureOnUpdateStorage = -1;
-
-		// Party
-		int32_t partyOnJoin = -1;
-		int32_t partyOnLeave = -1;
-		int32_t partyOnDisband = -1;
-		int32_t partyOnShareExperience = -1;
-		int32_t partyOnInvite = -1;
-		int32_t partyOnRevokeInvitation = -1;
-		int32_t partyOnPassLeadership = -1;
-
-		// Player
-		int32_t playerOnLook = -1;
-		int32_t playerOnLookInBattleList = -1;
-		int32_t playerOnLookInTrade = -1;
-		int32_t playerOnLookInShop = -1;
-		int32_t playerOnMoveItem = -1;
-		int32_t playerOnItemMoved = -1;
-		int32_t playerOnMoveCreature = -1;
-		int32_t playerOnStepTile = -1;
-		int32_t playerOnReportRuleViolation = -1;
-		int32_t playerOnReportBug = -1;
-		int32_t playerOnTurn = -1;
-		int32_t playerOnTradeRequest = -1;
-		int32_t playerOnTradeAccept = -1;
-		int32_t playerOnTradeCompleted = -1;
-		int32_t playerOnGainExperience = -1;
-		int32_t playerOnLoseExperience = -1;
-		int32_t playerOnGainSkillTries = -1;
-		int32_t playerOnNetworkMessage = -1;
-		int32_t playerOnUpdateInventory = -1;
-		int32_t playerOnRotateItem = -1;
-		int32_t playerOnSpellCheck = -1;
-
-		// Monster
-		int32_t monsterOnDropLoot = -1;
-		int32_t monsterOnSpawn = -1;
-	};
+	static constexpr size_t HOOK_COUNT = static_cast<size_t>(EventHook::LAST);
+	static_assert(HOOK_COUNT <= 64, "the hook mask is 64 bits");
 
 public:
 	Events();
@@ -127,21 +124,25 @@ public:
 	void eventMonsterOnDropLoot(Monster* monster, Container* corpse);
 	bool eventMonsterOnSpawn(Monster* monster, const Position& position, bool startup, bool artificial);
 
-	int32_t getScriptId(EventInfoId eventInfoId)
-	{
-		switch (eventInfoId) {
-			case EventInfoId::CREATURE_ONHEAR:
-				return info.creatureOnHear;
-			case EventInfoId::MONSTER_ONSPAWN:
-				return info.monsterOnSpawn;
-			default:
-				return -1;
-		}
-	};
+	int32_t getScriptId(EventHook hook) const { return scriptIds[static_cast<size_t>(hook)]; }
+
+	// whether calling the hook can do anything: it is enabled in events.xml and, if its method only forwards to
+	// EventCallback scripts (callbacksOnly="1"), one of them is registered. Hot call sites test it before they prepare
+	// the arguments of the event, the event functions test it as well.
+	bool hasHook(EventHook hook) const { return (activeHooks & (uint64_t{1} << static_cast<size_t>(hook))) != 0; }
+
+	// number of EventCallback scripts registered for the hooks of a method name, kept up to date by the
+	// event_callbacks lib; it outlives a reload of events.xml
+	void setCallbackCount(std::string_view methodName, uint32_t count);
 
 private:
+	void updateActiveHooks();
+
 	LuaScriptInterface scriptInterface;
-	EventsInfo info;
+	std::array<int32_t, HOOK_COUNT> scriptIds;
+	std::map<std::string, uint32_t, std::less<>> callbackCounts;
+	uint64_t callbacksOnlyHooks = 0;
+	uint64_t activeHooks = 0;
 };
 
 #endif
@@ -88,12 +88,15 @@ const Node& Loader::parseTree()
 	return root;
 }
 
-bool Loader::getProps(const Node& node, PropStream& props)
+bool Loader::getProps(const Node& node, PropStream& props) const
 {
 	auto size = std::distance(node.propsBegin, node.propsEnd);
 	if (size == 0) {
 		return false;
 	}
+
+	// map tile areas are decoded by several threads at once, each one unescapes into its own buffer
+	thread_local std::vector<char> propBuffer;
 	propBuffer.resize(size);
 	bool lastEscaped = false;
 
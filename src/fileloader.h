@@ -41,11 +41,11 @@ class Loader
 {
 	MappedFile fileContents;
 	Node root;
-	std::vector<char> propBuffer;
 
 public:
 	Loader(const std::string& fileName, const Identifier& acceptedIdentifier);
-	bool getProps(const Node& node, PropStream& props);
+	// props stay valid until the next call on the same thread
+	bool getProps(const Node& node, PropStream& props) const;
 	const Node& parseTree();
 };
 
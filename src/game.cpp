@@ -36,6 +36,7 @@ extern CreatureEvents* g_creatureEvents;
 extern Events* g_events;
 extern Monsters g_monsters;
 extern MoveEvents* g_moveEvents;
+extern LuaEnvironment g_luaEnvironment;
 extern Weapons* g_weapons;
 extern Scripts* g_scripts;
 
@@ -326,54 +327,21 @@ void Game::internalGetPosition(Item* item, Position& pos, uint8_t& stackpos)
 
 Creature* Game::getCreatureByID(uint32_t id)
 {
-	if (id <= Player::playerAutoID) {
-		return getPlayerByID(id);
-	} else if (id <= Monster::monsterAutoID) {
-		return getMonsterByID(id);
-	} else if (id <= Npc::npcAutoID) {
-		return getNpcByID(id);
+	if (PlayerRegistry::contains(id)) {
+		return playerIds.get(id);
+	} else if (MonsterRegistry::contains(id)) {
+		return monsterIds.get(id);
+	} else if (NpcRegistry::contains(id)) {
+		return npcIds.get(id);
 	}
 	return nullptr;
 }
 
-Monster* Game::getMonsterByID(uint32_t id)
-{
-	if (id == 0) {
-		return nullptr;
-	}
+Monster* Game::getMonsterByID(uint32_t id) { return monsterIds.get(id); }
 
-	auto it = monsters.find(id);
-	if (it == monsters.end()) {
-		return nullptr;
-	}
-	return it->second;
-}
+Npc* Game::getNpcByID(uint32_t id) { return npcIds.get(id); }
 
-Npc* Game::getNpcByID(uint32_t id)
-{
-	if (id == 0) {
-		return nullptr;
-	}
-
-	auto it = npcs.find(id);
-	if (it == npcs.end()) {
-		return nullptr;
-	}
-	return it->second;
-}
-
-Player* Game::getPlayerByID(uint32_t id)
-{
-	if (id == 0) {
-		return nullptr;
-	}
-
-	auto it = players.find(id);
-	if (it == players.end()) {
-		return nullptr;
-	}
-	return it->second;
-}
+Player* Game::getPlayerByID(uint32_t id) { return playerIds.get(id); }
 
 Creature* Game::getCreatureByName(const std::string& s)
 {
@@ -390,28 +358,17 @@ Creature* Game::getCreatureByName(const std::string& s)
 		}
 	}
 
-	auto equalCreatureName = [&](const std::pair<uint32_t, Creature*>& it) {
-		auto& name = it.second->getName();
+	auto equalCreatureName = [&](const Creature& creature) {
+		auto& name = creature.getName();
 		return lowerCaseName.size() == name.size() &&
 		       std::equal(lowerCaseName.begin(), lowerCaseName.end(), name.begin(),
 		                  [](char a, char b) { return a == std::tolower(b); });
 	};
 
-	{
-		auto it = std::find_if(npcs.begin(), npcs.end(), equalCreatureName);
-		if (it != npcs.end()) {
-			return it->second;
-		}
+	if (Npc* npc = npcIds.findIf(equalCreatureName)) {
+		return npc;
 	}
-
-	{
-		auto it = std::find_if(monsters.begin(), monsters.end(), equalCreatureName);
-		if (it != monsters.end()) {
-			return it->second;
-		}
-	}
-
-	return nullptr;
+	return monsterIds.findIf(equalCreatureName);
 }
 
 Npc* Game::getNpcByName(std::string_view npcName)
@@ -420,12 +377,7 @@ Npc* Game::getNpcByName(std::string_view npcName)
 		return nullptr;
 	}
 
-	for (const auto& it : npcs) {
-		if (caseInsensitiveEqual(npcName, it.second->getName())) {
-			return it.second;
-		}
-	}
-	return nullptr;
+	return npcIds.findIf([&](const Npc& npc) { return caseInsensitiveEqual(npcName, npc.getName()); });
 }
 
 Player* Game::getPlayerByName(std::string_view s)
@@ -498,12 +450,18 @@ bool Game::internalPlaceCreature(Creature* creature, const Position& pos, bool e
 		return false;
 	}
 
+	creature->setID();
+	if (creature->getID() == 0) {
+		std::cout << "[Warning - Game::internalPlaceCreature] No free creature id for " << creature->getName() << '.'
+		          << std::endl;
+		return false;
+	}
+
 	if (!map.placeCreature(pos, creature, extendedPos, forced)) {
 		return false;
 	}
 
 	creature->incrementReferenceCounter();
-	creature->setID();
 	creature->addList();
 	return true;
 }
@@ -1116,10 +1074,12 @@ ReturnValue Game::internalMoveItem(Cylinder* fromCylinder, Cylinder* toCylinder,
 {
 	Player* actorPlayer = actor ? actor->getPlayer() : nullptr;
 	if (actorPlayer && fromPos && toPos) {
-		const ReturnValue ret = g_events->eventPlayerOnMoveItem(actorPlayer, item, static_cast<uint16_t>(count),
-		                                                        *fromPos, *toPos, fromCylinder, toCylinder);
-		if (ret != RETURNVALUE_NOERROR) {
-			return ret;
+		if (g_events->hasHook(EventHook::PLAYER_ONMOVEITEM)) {
+			const ReturnValue ret = g_events->eventPlayerOnMoveItem(actorPlayer, item, static_cast<uint16_t>(count),
+			                                                        *fromPos, *toPos, fromCylinder, toCylinder);
+			if (ret != RETURNVALUE_NOERROR) {
+				return ret;
+			}
 		}
 
 		if (!actorPlayer->hasFlag(PlayerFlag_CanEditHouses)) {
@@ -1216,7 +1176,7 @@ ReturnValue Game::internalMoveItem(Cylinder* fromCylinder, Cylinder* toCylinder,
 		// check if we can add it to source cylinder
 		ret = fromCylinder->queryAdd(fromCylinder->getThingIndex(item), *toItem, toItem->getItemCount(), 0);
 		if (ret == RETURNVALUE_NOERROR) {
-			if (actorPlayer && fromPos && toPos) {
+			if (actorPlayer && fromPos && toPos && g_events->hasHook(EventHook::PLAYER_ONMOVEITEM)) {
 				const ReturnValue eventRet = g_events->eventPlayerOnMoveItem(
 				    actorPlayer, toItem, toItem->getItemCount(), *toPos, *fromPos, toCylinder, fromCylinder);
 				if (eventRet != RETURNVALUE_NOERROR) {
@@ -1249,7 +1209,8 @@ ReturnValue Game::internalMoveItem(Cylinder* fromCylinder, Cylinder* toCylinder,
 
 				ret = toCylinder->queryAdd(index, *item, count, flags, actor);
 
-				if (actorPlayer && fromPos && toPos && !toItem->isRemoved()) {
+				if (actorPlayer && fromPos && toPos && !toItem->isRemoved() &&
+				    g_events->hasHook(EventHook::PLAYER_ONITEMMOVED)) {
 					g_events->eventPlayerOnItemMoved(actorPlayer, toItem, static_cast<uint16_t>(count), *toPos,
 					                                 *fromPos, toCylinder, fromCylinder);
 				}
@@ -1369,7 +1330,7 @@ ReturnValue Game::internalMoveItem(Cylinder* fromCylinder, Cylinder* toCylinder,
 		return retMaxCount;
 	}
 
-	if (actorPlayer && fromPos && toPos) {
+	if (actorPlayer && fromPos && toPos && g_events->hasHook(EventHook::PLAYER_ONITEMMOVED)) {
 		if (updateItem && !updateItem->isRemoved()) {
 			g_events->eventPlayerOnItemMoved(actorPlayer, updateItem, static_cast<uint16_t>(count), *fromPos, *toPos,
 			                                 fromCylinder, toCylinder);
@@ -4667,20 +4628,19 @@ void Game::addDistanceEffect(const SpectatorVec& spectators, const Position& fro
 void Game::setAccountStorageValue(const uint32_t accountId, const uint32_t key, const int32_t value)
 {
 	if (value == -1) {
-		accountStorageMap[accountId].erase(key);
+		accountStorageMap[accountId].set(key, std::nullopt);
 		return;
 	}
 
-	accountStorageMap[accountId][key] = value;
+	accountStorageMap[accountId].set(key, value);
 }
 
 int32_t Game::getAccountStorageValue(const uint32_t accountId, const uint32_t key) const
 {
-	const auto& accountMapIt = accountStorageMap.find(accountId);
-	if (accountMapIt != accountStorageMap.end()) {
-		const auto& storageMapIt = accountMapIt->second.find(key);
-		if (storageMapIt != accountMapIt->second.end()) {
-			return storageMapIt->second;
+	auto it = accountStorageMap.find(accountId);
+	if (it != accountStorageMap.end()) {
+		if (auto value = it->second.get(key)) {
+			return static_cast<int32_t>(*value);
 		}
 	}
 	return -1;
@@ -4693,44 +4653,33 @@ void Game::loadAccountStorageValues()
 	DBResult_ptr result;
 	if ((result = db.storeQuery("SELECT `account_id`, `key`, `value` FROM `account_storage`"))) {
 		do {
-			g_game.setAccountStorageValue(result->getNumber<uint32_t>("account_id"), result->getNumber<uint32_t>("key"),
-			                              result->getNumber<int32_t>("value"));
+			accountStorageMap[result->getNumber<uint32_t>("account_id")].set(
+			    result->getNumber<uint32_t>("key"), result->getNumber<int32_t>("value"), false);
 		} while (result->next());
 	}
 }
 
-bool Game::saveAccountStorageValues() const
+bool Game::saveAccountStorageValues()
 {
 	DBTransaction transaction;
-	Database& db = Database::getInstance();
-
 	if (!transaction.begin()) {
 		return false;
 	}
 
-	if (!db.executeQuery("DELETE FROM `account_storage`")) {
-		return false;
-	}
-
-	for (const auto& accountIt : g_game.accountStorageMap) {
-		if (accountIt.second.empty()) {
-			break;
-		}
-
-		DBInsert accountStorageQuery("INSERT INTO `account_storage` (`account_id`, `key`, `value`) VALUES");
-		for (const auto& storageIt : accountIt.second) {
-			if (!accountStorageQuery.addRow(
-			        fmt::format("{:d}, {:d}, {:d}", accountIt.first, storageIt.first, storageIt.second))) {
-				return false;
-			}
-		}
-
-		if (!accountStorageQuery.execute()) {
+	for (const auto& [accountId, storages] : accountStorageMap) {
+		if (!saveChangedStorages(storages, "account_storage", "account_id", accountId)) {
 			return false;
 		}
 	}
 
-	return transaction.commit();
+	if (!transaction.commit()) {
+		return false;
+	}
+
+	for (auto& it : accountStorageMap) {
+		it.second.clearDirty();
+	}
+	return true;
 }
 
 void Game::startDecay(Item* item)
@@ -4825,6 +4774,7 @@ void Game::shutdown()
 {
 	std::cout << "Shutting down..." << std::flush;
 
+	g_monsters.stopPreload();
 	g_scheduler.shutdown();
 	g_databaseTasks.shutdown();
 	g_dispatcher.shutdown();
@@ -5253,6 +5203,7 @@ void Game::addPlayer(Player* player)
 	mappedPlayerGuids[player->getGUID()] = player;
 	wildcardTree.insert(lowercase_name);
 	players[player->getID()] = player;
+	playerIds.set(player->getID(), player);
 }
 
 void Game::removePlayer(Player* player)
@@ -5262,15 +5213,16 @@ void Game::removePlayer(Player* player)
 	mappedPlayerGuids.erase(player->getGUID());
 	wildcardTree.remove(lowercase_name);
 	players.erase(player->getID());
+	playerIds.set(player->getID(), nullptr);
 }
 
-void Game::addNpc(Npc* npc) { npcs[npc->getID()] = npc; }
+void Game::addNpc(Npc* npc) { npcIds.set(npc->getID(), npc); }
 
-void Game::removeNpc(Npc* npc) { npcs.erase(npc->getID()); }
+void Game::removeNpc(Npc* npc) { npcIds.set(npc->getID(), nullptr); }
 
-void Game::addMonster(Monster* monster) { monsters[monster->getID()] = monster; }
+void Game::addMonster(Monster* monster) { monsterIds.set(monster->getID(), monster); }
 
-void Game::removeMonster(Monster* monster) { monsters.erase(monster->getID()); }
+void Game::removeMonster(Monster* monster) { monsterIds.set(monster->getID(), nullptr); }
 
 Guild* Game::getGuild(uint32_t id) const
 {
@@ -5361,8 +5313,14 @@ bool Game::reload(ReloadTypes_t reloadType)
 			return g_actions->reload();
 		case RELOAD_TYPE_CHAT:
 			return g_chat->load();
-		case RELOAD_TYPE_CONFIG:
-			return ConfigManager::load();
+		case RELOAD_TYPE_CONFIG: {
+			if (!ConfigManager::load()) {
+				return false;
+			}
+
+			g_luaEnvironment.configureGarbageCollector();
+			return true;
+		}
 		case RELOAD_TYPE_CREATURESCRIPTS: {
 			g_creatureEvents->reload();
 			g_creatureEvents->removeInvalidEvents();
@@ -5477,52 +5435,30 @@ void Game::loadGameStorageValues()
 	DBResult_ptr result;
 	if ((result = db.storeQuery("SELECT `key`, `value` FROM `game_storage`"))) {
 		do {
-			g_game.setStorageValue(result->getNumber<uint32_t>("key"), result->getNumber<int32_t>("value"));
+			storageMap.set(result->getNumber<uint32_t>("key"), result->getNumber<int32_t>("value"), false);
 		} while (result->next());
 	}
 }
 
-bool Game::saveGameStorageValues() const
+bool Game::saveGameStorageValues()
 {
-	DBTransaction transaction;
-	Database& db = Database::getInstance();
+	if (!storageMap.hasDirty()) {
+		return true;
+	}
 
+	DBTransaction transaction;
 	if (!transaction.begin()) {
 		return false;
 	}
 
-	if (!db.executeQuery("DELETE FROM `game_storage`")) {
+	if (!saveChangedStorages(storageMap, "game_storage") || !transaction.commit()) {
 		return false;
 	}
 
-	for (const auto& [key, value] : g_game.storageMap) {
-		DBInsert gameStorageQuery("INSERT INTO `game_storage` (`key`, `value`) VALUES");
-		if (!gameStorageQuery.addRow(fmt::format("{:d}, {:d}", key, value))) {
-			return false;
-		}
-
-		if (!gameStorageQuery.execute()) {
-			return false;
-		}
-	}
-
-	return transaction.commit();
+	storageMap.clearDirty();
+	return true;
 }
 
-void Game::setStorageValue(uint32_t key, std::optional<int64_t> value)
-{
-	if (value) {
-		storageMap.insert_or_assign(key, value.value());
-	} else {
-		storageMap.erase(key);
-	}
-}
+void Game::setStorageValue(uint32_t key, std::optional<int64_t> value) { storageMap.set(key, value); }
 
-std::optional<int64_t> Game::getStorageValue(uint32_t key) const
-{
-	auto it = storageMap.find(key);
-	if (it == storageMap.end()) {
-		return std::nullopt;
-	}
-	return std::make_optional(it->second);
-}
+std::optional<int64_t> Game::getStorageValue(uint32_t key) const { return storageMap.get(key); }
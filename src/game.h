@@ -7,6 +7,7 @@
 #include "account.h"
 #include "combat.h"
 #include "container.h"
+#include "creatureregistry.h"
 #include "groups.h"
 #include "item.h"
 #include "map.h"
@@ -66,6 +67,11 @@ inline constexpr int32_t RANGE_BROWSE_FIELD_INTERVAL = 400;
 inline constexpr int32_t RANGE_WRAP_ITEM_INTERVAL = 400;
 inline constexpr int32_t RANGE_REQUEST_TRADE_INTERVAL = 400;
 
+// creature id ranges: players from 0x10000000, monsters from 0x40000000 and npcs from 0x80000000
+using PlayerRegistry = CreatureRegistry<Player, 0x10000000, 16, 13>;
+using MonsterRegistry = CreatureRegistry<Monster, 0x40000000, 20, 10>;
+using NpcRegistry = CreatureRegistry<Npc, 0x80000000, 16, 15>;
+
 /**
  * Main Game class.
  * This class is responsible to control everything that happens
@@ -225,8 +231,8 @@ public:
 	static void removeCreatureCheck(Creature* creature);
 
 	size_t getPlayersOnline() const { return players.size(); }
-	size_t getMonstersOnline() const { return monsters.size(); }
-	size_t getNpcsOnline() const { return npcs.size(); }
+	size_t getMonstersOnline() const { return monsterIds.size(); }
+	size_t getNpcsOnline() const { return npcIds.size(); }
 	uint32_t getPlayersRecord() const { return playersRecord; }
 
 	LightInfo getWorldLightInfo() const { return {lightLevel, lightColor}; }
@@ -458,7 +464,7 @@ public:
 	void setAccountStorageValue(const uint32_t accountId, const uint32_t key, const int32_t value);
 	int32_t getAccountStorageValue(const uint32_t accountId, const uint32_t key) const;
 	void loadAccountStorageValues();
-	bool saveAccountStorageValues() const;
+	bool saveAccountStorageValues();
 
 	void startDecay(Item* item);
 	void stopDecay(Item* item);
@@ -474,7 +480,15 @@ public:
 	void incrementMotdNum() { motdNum++; }
 
 	const std::unordered_map<uint32_t, Player*>& getPlayers() const { return players; }
-	const std::map<uint32_t, Npc*>& getNpcs() const { return npcs; }
+	const NpcRegistry& getNpcs() const { return npcIds; }
+
+	// ids are reserved by Creature::setID and released when the creature is destroyed
+	uint32_t reservePlayerId() { return playerIds.reserve(); }
+	void releasePlayerId(uint32_t id) { playerIds.release(id); }
+	uint32_t reserveMonsterId() { return monsterIds.reserve(); }
+	void releaseMonsterId(uint32_t id) { monsterIds.release(id); }
+	uint32_t reserveNpcId() { return npcIds.reserve(); }
+	void releaseNpcId(uint32_t id) { npcIds.release(id); }
 
 	void addPlayer(Player* player);
 	void removePlayer(Player* player);
@@ -514,16 +528,16 @@ public:
 	void clearTilesToClean() { tilesToClean.clear(); }
 
 	void loadGameStorageValues();
-	bool saveGameStorageValues() const;
+	bool saveGameStorageValues();
 
 	void setStorageValue(uint32_t key, std::optional<int64_t> value);
 	std::optional<int64_t> getStorageValue(uint32_t key) const;
-	decltype(auto) getStorageMap() const { return storageMap; }
+	const StorageMap& getStorageMap() const { return storageMap; }
 
 	void sendOfflineTrainingDialog(Player* player);
 
 private:
-	std::map<uint32_t, int64_t> storageMap;
+	StorageMap storageMap;
 
 	bool playerSaySpell(Player* player, SpeakClasses type, std::string_view text);
 	void playerWhisper(Player* player, std::string_view text);
@@ -532,12 +546,15 @@ private:
 	void playerSpeakToNpc(Player* player, std::string_view text);
 
 	std::unordered_map<uint32_t, Player*> players;
+	PlayerRegistry playerIds;
+	MonsterRegistry monsterIds;
+	NpcRegistry npcIds;
 	std::unordered_map<std::string, Player*> mappedPlayerNames;
 	std::unordered_map<uint32_t, Player*> mappedPlayerGuids;
 	std::unordered_map<uint32_t, Guild*> guilds;
 	std::unordered_map<uint16_t, Item*> uniqueItems;
 	std::map<uint32_t, uint32_t> stages;
-	std::unordered_map<uint32_t, std::unordered_map<uint32_t, int32_t>> accountStorageMap;
+	std::unordered_map<uint32_t, StorageMap> accountStorageMap;
 
 	std::list<Creature*> checkCreatureLists[EVENT_CREATURECOUNT];
 
@@ -548,9 +565,6 @@ private:
 
 	WildcardTreeNode wildcardTree{false};
 
-	std::map<uint32_t, Npc*> npcs;
-	std::map<uint32_t, Monster*> monsters;
-
 	// list of items that are in trading state, mapped to the player
 	std::map<Item*, uint32_t> tradeItems;
 
@@ -12,7 +12,7 @@
 
 GlobalEvents::GlobalEvents() : scriptInterface("GlobalEvent Interface") { scriptInterface.initState(); }
 
-GlobalEvents::~GlobalEvents() { clear(false); }
+GlobalEvents::~GlobalEvents() { g_scheduler.stopEvent(thinkEventId); }
 
 void GlobalEvents::clearMap(GlobalEventMap& map, bool fromLua)
 {
@@ -27,14 +27,10 @@ void GlobalEvents::clearMap(GlobalEventMap& map, bool fromLua)
 
 void GlobalEvents::clear(bool fromLua)
 {
-	g_scheduler.stopEvent(thinkEventId);
-	thinkEventId = 0;
-	g_scheduler.stopEvent(timerEventId);
-	timerEventId = 0;
-
 	clearMap(thinkMap, fromLua);
 	clearMap(serverMap, fromLua);
 	clearMap(timerMap, fromLua);
+	rescheduleAll();
 
 	reInitState(fromLua);
 }
@@ -49,44 +45,18 @@ Event_ptr GlobalEvents::getEvent(std::string_view nodeName)
 
 bool GlobalEvents::registerEvent(Event_ptr event, const pugi::xml_node&)
 {
-	GlobalEvent_ptr globalEvent{static_cast<GlobalEvent*>(event.release())}; // event is guaranteed to be a GlobalEvent
-	if (globalEvent->getEventType() == GLOBALEVENT_TIMER) {
-		auto result = timerMap.emplace(globalEvent->getName(), std::move(*globalEvent));
-		if (result.second) {
-			if (timerEventId == 0) {
-				timerEventId = g_scheduler.addEvent(createSchedulerTask(SCHEDULER_MINTICKS, [this]() { timer(); }));
-			}
-			return true;
-		}
-	} else if (globalEvent->getEventType() != GLOBALEVENT_NONE) {
-		auto result = serverMap.emplace(globalEvent->getName(), std::move(*globalEvent));
-		if (result.second) {
-			return true;
-		}
-	} else { // think event
-		auto result = thinkMap.emplace(globalEvent->getName(), std::move(*globalEvent));
-		if (result.second) {
-			if (thinkEventId == 0) {
-				thinkEventId = g_scheduler.addEvent(createSchedulerTask(SCHEDULER_MINTICKS, [this]() { think(); }));
-			}
-			return true;
-		}
-	}
-
-	std::cout << "[Warning - GlobalEvents::configureEvent] Duplicate registered globalevent with name: "
-	          << globalEvent->getName() << std::endl;
-	return false;
+	// event is guaranteed to be a GlobalEvent
+	return addEvent(GlobalEvent_ptr{static_cast<GlobalEvent*>(event.release())});
 }
 
-bool GlobalEvents::registerLuaEvent(GlobalEvent* event)
+bool GlobalEvents::registerLuaEvent(GlobalEvent* event) { return addEvent(GlobalEvent_ptr{event}); }
+
+bool GlobalEvents::addEvent(GlobalEvent_ptr globalEvent)
 {
-	GlobalEvent_ptr globalEvent{event};
 	if (globalEvent->getEventType() == GLOBALEVENT_TIMER) {
 		auto result = timerMap.emplace(globalEvent->getName(), std::move(*globalEvent));
 		if (result.second) {
-			if (timerEventId == 0) {
-				timerEventId = g_scheduler.addEvent(createSchedulerTask(SCHEDULER_MINTICKS, [this]() { timer(); }));
-			}
+			schedule(result.first->second);
 			return true;
 		}
 	} else if (globalEvent->getEventType() != GLOBALEVENT_NONE) {
@@ -97,9 +67,7 @@ bool GlobalEvents::registerLuaEvent(GlobalEvent* event)
 	} else { // think event
 		auto result = thinkMap.emplace(globalEvent->getName(), std::move(*globalEvent));
 		if (result.second) {
-			if (thinkEventId == 0) {
-				thinkEventId = g_scheduler.addEvent(createSchedulerTask(SCHEDULER_MINTICKS, [this]() { think(); }));
-			}
+			schedule(result.first->second);
 			return true;
 		}
 	}
@@ -109,87 +77,80 @@ bool GlobalEvents::registerLuaEvent(GlobalEvent* event)
 	return false;
 }
 
-void GlobalEvents::startup() const { execute(GLOBALEVENT_STARTUP); }
-
-void GlobalEvents::timer()
+void GlobalEvents::schedule(GlobalEvent& globalEvent)
 {
-	auto now = OTSYS_TIME();
-
-	int64_t nextScheduledTime = std::numeric_limits<int64_t>::max();
-
-	auto it = timerMap.begin();
-	while (it != timerMap.end()) {
-		GlobalEvent& globalEvent = it->second;
+	dueEvents.push({globalEvent.getNextExecution(), &globalEvent});
+	scheduleThink(globalEvent.getNextExecution());
+}
 
-		int64_t nextExecutionTime = globalEvent.getNextExecution() - now;
-		if (nextExecutionTime > 0) {
-			if (nextExecutionTime < nextScheduledTime) {
-				nextScheduledTime = nextExecutionTime;
-			}
+void GlobalEvents::scheduleThink(int64_t time)
+{
+	if (thinkEventId != 0 && thinkTime <= time) {
+		return;
+	}
 
-			++it;
-			continue;
-		}
+	g_scheduler.stopEvent(thinkEventId);
+	thinkTime = time;
+	thinkEventId = g_scheduler.addEvent(
+	    createSchedulerTask(std::max<int64_t>(SCHEDULER_MINTICKS, time - OTSYS_TIME()), [this]() { think(); }));
+}
 
-		if (!globalEvent.executeEvent()) {
-			it = timerMap.erase(it);
-			continue;
-		}
+void GlobalEvents::rescheduleAll()
+{
+	g_scheduler.stopEvent(thinkEventId);
+	thinkEventId = 0;
+	dueEvents = {};
 
-		nextExecutionTime = 86400000;
-		if (nextExecutionTime < nextScheduledTime) {
-			nextScheduledTime = nextExecutionTime;
+	for (GlobalEventMap* map : {&thinkMap, &timerMap}) {
+		for (auto& it : *map) {
+			schedule(it.second);
 		}
-
-		globalEvent.setNextExecution(globalEvent.getNextExecution() + nextExecutionTime);
-
-		++it;
-	}
-
-	if (nextScheduledTime != std::numeric_limits<int64_t>::max()) {
-		thinkEventId = g_scheduler.addEvent(createSchedulerTask(nextScheduledTime, [this]() { timer(); }));
 	}
 }
 
+void GlobalEvents::startup() { execute(GLOBALEVENT_STARTUP); }
+
 void GlobalEvents::think()
 {
-	auto now = OTSYS_TIME();
+	thinkEventId = 0;
 
-	int64_t nextScheduledTime = std::numeric_limits<int64_t>::max();
-	for (auto& it : thinkMap) {
-		GlobalEvent& globalEvent = it.second;
+	const int64_t now = OTSYS_TIME();
+	while (!dueEvents.empty() && dueEvents.top().time <= now) {
+		GlobalEvent* globalEvent = dueEvents.top().event;
+		dueEvents.pop();
 
-		int64_t nextExecutionTime = globalEvent.getNextExecution() - now;
-		if (nextExecutionTime > 0) {
-			if (nextExecutionTime < nextScheduledTime) {
-				nextScheduledTime = nextExecutionTime;
+		if (globalEvent->getEventType() == GLOBALEVENT_TIMER) {
+			if (!globalEvent->executeEvent()) {
+				timerMap.erase(std::string{globalEvent->getName()});
+				continue;
 			}
-			continue;
-		}
 
-		if (!globalEvent.executeEvent()) {
-			std::cout << "[Error - GlobalEvents::think] Failed to execute event: " << globalEvent.getName()
-			          << std::endl;
-		}
+			globalEvent->setNextExecution(globalEvent->getNextExecution() + 86400000);
+		} else {
+			if (!globalEvent->executeEvent()) {
+				std::cout << "[Error - GlobalEvents::think] Failed to execute event: " << globalEvent->getName()
+				          << std::endl;
+			}
 
-		nextExecutionTime = globalEvent.getInterval();
-		if (nextExecutionTime < nextScheduledTime) {
-			nextScheduledTime = nextExecutionTime;
+			// an event that fell behind runs once and continues from now, it does not run for each interval missed
+			int64_t nextExecution = globalEvent->getNextExecution() + globalEvent->getInterval();
+			if (nextExecution <= now) {
+				nextExecution = now + globalEvent->getInterval();
+			}
+			globalEvent->setNextExecution(nextExecution);
 		}
-
-		globalEvent.setNextExecution(globalEvent.getNextExecution() + nextExecutionTime);
+		dueEvents.push({globalEvent->getNextExecution(), globalEvent});
 	}
 
-	if (nextScheduledTime != std::numeric_limits<int64_t>::max()) {
-		timerEventId = g_scheduler.addEvent(
-		    createSchedulerTask(std::max<int64_t>(1000, nextScheduledTime), [this]() { think(); }));
+	if (!dueEvents.empty()) {
+		scheduleThink(dueEvents.top().time);
 	}
 }
 
-void GlobalEvents::execute(GlobalEvent_t type) const
+void GlobalEvents::execute(GlobalEvent_t type)
 {
-	for (const auto& it : serverMap) {
-		const GlobalEvent& globalEvent = it.second;
+	for (auto& it : serverMap) {
+		GlobalEvent& globalEvent = it.second;
 		if (globalEvent.getEventType() == type) {
 			globalEvent.executeEvent();
 		}
@@ -338,7 +299,7 @@ bool GlobalEvent::executeRecord(uint32_t current, uint32_t old)
 	return scriptInterface->callFunction(2);
 }
 
-bool GlobalEvent::executeEvent() const
+bool GlobalEvent::executeEvent()
 {
 	if (!scriptInterface->reserveScriptEnv()) {
 		std::cout << "[Error - GlobalEvent::executeEvent] Call stack overflow" << std::endl;
@@ -356,5 +317,12 @@ bool GlobalEvent::executeEvent() const
 		params = 1;
 	}
 
-	return scriptInterface->callFunction(params);
+	auto start = std::chrono::steady_clock::now();
+	bool result = scriptInterface->callFunction(params);
+	auto elapsed = std::chrono::steady_clock::now() - start;
+
+	++stats.executions;
+	stats.totalTime += elapsed;
+	stats.maxTime = std::max(stats.maxTime, elapsed);
+	return result;
 }
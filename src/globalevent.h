@@ -6,6 +6,8 @@
 #include "baseevents.h"
 #include "const.h"
 
+#include <queue>
+
 enum GlobalEvent_t
 {
 	GLOBALEVENT_NONE,
@@ -20,6 +22,13 @@ class GlobalEvent;
 using GlobalEvent_ptr = std::unique_ptr<GlobalEvent>;
 using GlobalEventMap = std::map<std::string, GlobalEvent>;
 
+struct GlobalEventStats
+{
+	uint64_t executions = 0;
+	std::chrono::steady_clock::duration totalTime{};
+	std::chrono::steady_clock::duration maxTime{};
+};
+
 class GlobalEvents final : public BaseEvents
 {
 public:
@@ -30,15 +39,16 @@ public:
 	GlobalEvents(const GlobalEvents&) = delete;
 	GlobalEvents& operator=(const GlobalEvents&) = delete;
 
-	void startup() const;
+	void startup();
 
-	void timer();
-	void think();
-	void execute(GlobalEvent_t type) const;
+	void execute(GlobalEvent_t type);
 
 	GlobalEventMap getEventMap(GlobalEvent_t type);
 	static void clearMap(GlobalEventMap& map, bool fromLua);
 
+	template <typename Func>
+	void forEachEvent(Func&& func) const;
+
 	bool registerLuaEvent(GlobalEvent* event);
 	void clear(bool fromLua) override final;
 
@@ -51,8 +61,26 @@ private:
 	LuaScriptInterface& getScriptInterface() override { return scriptInterface; }
 	LuaScriptInterface scriptInterface;
 
+	// think and timer events share one scheduler event, armed for the first of them to become due; it only runs the
+	// events that are due
+	struct ScheduledEvent
+	{
+		int64_t time;
+		GlobalEvent* event;
+
+		bool operator>(const ScheduledEvent& other) const { return time > other.time; }
+	};
+
+	bool addEvent(GlobalEvent_ptr globalEvent);
+	void schedule(GlobalEvent& globalEvent);
+	void scheduleThink(int64_t time);
+	void rescheduleAll();
+	void think();
+
 	GlobalEventMap thinkMap, serverMap, timerMap;
-	int32_t thinkEventId = 0, timerEventId = 0;
+	std::priority_queue<ScheduledEvent, std::vector<ScheduledEvent>, std::greater<>> dueEvents;
+	int64_t thinkTime = 0;
+	uint32_t thinkEventId = 0;
 };
 
 class GlobalEvent final : public Event
@@ -63,7 +91,7 @@ public:
 	bool configureEvent(const pugi::xml_node& node) override;
 
 	bool executeRecord(uint32_t current, uint32_t old);
-	bool executeEvent() const;
+	bool executeEvent();
 
 	GlobalEvent_t getEventType() const { return eventType; }
 	void setEventType(GlobalEvent_t type) { eventType = type; }
@@ -77,14 +105,28 @@ public:
 	int64_t getNextExecution() const { return nextExecution; }
 	void setNextExecution(int64_t time) { nextExecution = time; }
 
+	// executions of the event since it was loaded and the time they took
+	const GlobalEventStats& getStats() const { return stats; }
+
 private:
 	GlobalEvent_t eventType = GLOBALEVENT_NONE;
 
 	std::string_view getScriptEventName() const override;
 
 	std::string name;
+	GlobalEventStats stats;
 	int64_t nextExecution = 0;
 	uint32_t interval = 0;
 };
 
+template <typename Func>
+void GlobalEvents::forEachEvent(Func&& func) const
+{
+	for (const GlobalEventMap* map : {&thinkMap, &timerMap, &serverMap}) {
+		for (const auto& it : *map) {
+			func(it.second);
+		}
+	}
+}
+
 #endif
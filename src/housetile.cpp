@@ -8,9 +8,25 @@
 #include "configmanager.h"
 #include "game.h"
 #include "house.h"
+#include "slab.h"
 
 extern Game g_game;
 
+namespace {
+
+SlabAllocator& getHouseTileAllocator()
+{
+	// never destroyed, tiles may still be released during static destruction
+	static auto* allocator = new SlabAllocator("HouseTile", sizeof(HouseTile));
+	return *allocator;
+}
+
+} // namespace
+
+void* HouseTile::operator new(size_t size) { return getHouseTileAllocator().allocate(size); }
+
+void HouseTile::operator delete(void* p, size_t size) { getHouseTileAllocator().deallocate(p, size); }
+
 HouseTile::HouseTile(uint16_t x, uint16_t y, uint8_t z, House* house) : DynamicTile(x, y, z), house(house) {}
 
 void HouseTile::addThing(int32_t index, Thing* thing)
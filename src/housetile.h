@@ -13,6 +13,10 @@ class HouseTile final : public DynamicTile
 public:
 	HouseTile(uint16_t x, uint16_t y, uint8_t z, House* house);
 
+	// allocated from a slab, see slab.h
+	static void* operator new(size_t size);
+	static void operator delete(void* p, size_t size);
+
 	using Tile::internalAddThing;
 
 	// cylinder implementations
@@ -0,0 +1,49 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#ifndef FS_IDTABLE_H
+#define FS_IDTABLE_H
+
+// Flat lookup table keyed by a dense 16-bit id (item id, action id, unique id). A lookup is a bounds check and an
+// array load. The table does not own the pointed-to values.
+template <typename T>
+class IdTable
+{
+public:
+	T* get(uint16_t id) const { return id < table.size() ? table[id] : nullptr; }
+
+	void set(uint16_t id, T* value)
+	{
+		if (id >= table.size()) {
+			table.resize(id + 1, nullptr);
+		}
+		table[id] = value;
+	}
+
+	void clear() { table.clear(); }
+
+	template <typename Predicate>
+	void eraseIf(Predicate&& predicate)
+	{
+		for (T*& value : table) {
+			if (value && predicate(*value)) {
+				value = nullptr;
+			}
+		}
+	}
+
+	template <typename Func>
+	void forEach(Func&& func) const
+	{
+		for (size_t id = 0, size = table.size(); id < size; ++id) {
+			if (table[id]) {
+				func(static_cast<uint16_t>(id), *table[id]);
+			}
+		}
+	}
+
+private:
+	std::vector<T*> table;
+};
+
+#endif // FS_IDTABLE_H
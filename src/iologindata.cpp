@@ -10,12 +10,20 @@
 
 extern Game g_game;
 
-Account IOLoginData::loadAccount(uint32_t accno)
-{
-	Account account;
+namespace {
 
-	DBResult_ptr result = Database::getInstance().storeQuery(fmt::format(
+constexpr std::string_view playerColumns =
+    "SELECT `id`, `name`, `account_id`, `group_id`, `sex`, `vocation`, `experience`, `level`, `maglevel`, `health`, `healthmax`, `blessings`, `mana`, `manamax`, `manaspent`, `soul`, `lookbody`, `lookfeet`, `lookhead`, `looklegs`, `looktype`, `lookaddons`, `currentmount`, `randomizemount`, `posx`, `posy`, `posz`, `cap`, `lastlogin`, `lastlogout`, `lastip`, `conditions`, `skulltime`, `skull`, `town_id`, `balance`, `stamina`, `skill_fist`, `skill_fist_tries`, `skill_club`, `skill_club_tries`, `skill_sword`, `skill_sword_tries`, `skill_axe`, `skill_axe_tries`, `skill_dist`, `skill_dist_tries`, `skill_shielding`, `skill_shielding_tries`, `skill_fishing`, `skill_fishing_tries`, `direction`, `offlinetraining_time`, `offlinetraining_skill` FROM `players`";
+
+DBResult_ptr queryAccount(Database& db, uint32_t accno)
+{
+	return db.storeQuery(fmt::format(
 	    "SELECT `id`, `name`, `type`, `premium_ends_at`, `tibia_coins` FROM `accounts` WHERE `id` = {:d}", accno));
+}
+
+Account readAccount(const DBResult_ptr& result)
+{
+	Account account;
 	if (!result) {
 		return account;
 	}
@@ -28,6 +36,20 @@ Account IOLoginData::loadAccount(uint32_t accno)
 	return account;
 }
 
+// logins whose rows are being fetched on the database thread, only touched on the dispatcher
+struct PendingLogin
+{
+	uint32_t count = 0;
+	uint64_t lastWrite = 0;
+};
+
+std::unordered_map<uint32_t, PendingLogin> pendingLogins;
+uint64_t lastWrite = 0;
+
+} // namespace
+
+Account IOLoginData::loadAccount(uint32_t accno) { return readAccount(queryAccount(Database::getInstance(), accno)); }
+
 std::string decodeSecret(std::string_view secret)
 {
 	// simple base32 decoding
@@ -255,21 +277,84 @@ bool IOLoginData::preloadPlayer(Player* player)
 bool IOLoginData::loadPlayerById(Player* player, uint32_t id)
 {
 	Database& db = Database::getInstance();
-	return loadPlayer(
-	    player,
-	    db.storeQuery(fmt::format(
-	        "SELECT `id`, `name`, `account_id`, `group_id`, `sex`, `vocation`, `experience`, `level`, `maglevel`, `health`, `healthmax`, `blessings`, `mana`, `manamax`, `manaspent`, `soul`, `lookbody`, `lookfeet`, `lookhead`, `looklegs`, `looktype`, `lookaddons`, `currentmount`, `randomizemount`, `posx`, `posy`, `posz`, `cap`, `lastlogin`, `lastlogout`, `lastip`, `conditions`, `skulltime`, `skull`, `town_id`, `balance`, `stamina`, `skill_fist`, `skill_fist_tries`, `skill_club`, `skill_club_tries`, `skill_sword`, `skill_sword_tries`, `skill_axe`, `skill_axe_tries`, `skill_dist`, `skill_dist_tries`, `skill_shielding`, `skill_shielding_tries`, `skill_fishing`, `skill_fishing_tries`, `direction`, `offlinetraining_time`, `offlinetraining_skill` FROM `players` WHERE `id` = {:d}",
-	        id)));
+	return loadPlayer(player, db.storeQuery(fmt::format("{:s} WHERE `id` = {:d}", playerColumns, id)));
 }
 
 bool IOLoginData::loadPlayerByName(Player* player, std::string_view name)
 {
 	Database& db = Database::getInstance();
-	return loadPlayer(
-	    player,
-	    db.storeQuery(fmt::format(
-	        "SELECT `id`, `name`, `account_id`, `group_id`, `sex`, `vocation`, `experience`, `level`, `maglevel`, `health`, `healthmax`, `blessings`, `mana`, `manamax`, `manaspent`, `soul`, `lookbody`, `lookfeet`, `lookhead`, `looklegs`, `looktype`, `lookaddons`, `currentmount`, `randomizemount`, `posx`, `posy`, `posz`, `cap`, `lastlogin`, `lastlogout`, `lastip`, `conditions`, `skulltime`, `skull`, `town_id`, `balance`, `stamina`, `skill_fist`, `skill_fist_tries`, `skill_club`, `skill_club_tries`, `skill_sword`, `skill_sword_tries`, `skill_axe`, `skill_axe_tries`, `skill_dist`, `skill_dist_tries`, `skill_shielding`, `skill_shielding_tries`, `skill_fishing`, `skill_fishing_tries`, `direction`, `offlinetraining_time`, `offlinetraining_skill` FROM `players` WHERE `name` = {:s}",
-	        db.escapeString(name))));
+	return loadPlayer(player,
+	                  db.storeQuery(fmt::format("{:s} WHERE `name` = {:s}", playerColumns, db.escapeString(name))));
+}
+
+PlayerLoadData IOLoginData::fetchPlayerById(Database& db, uint32_t id)
+{
+	int64_t start = OTSYS_TIME();
+
+	PlayerLoadData data;
+	data.player = db.storeQuery(fmt::format("{:s} WHERE `id` = {:d}", playerColumns, id));
+	if (data.player) {
+		fetchPlayerTables(db, data);
+	}
+
+	data.fetchTime = OTSYS_TIME() - start;
+	return data;
+}
+
+uint64_t IOLoginData::beginLogin(uint32_t guid)
+{
+	++pendingLogins[guid].count;
+	return lastWrite;
+}
+
+bool IOLoginData::endLogin(uint32_t guid, uint64_t token)
+{
+	auto it = pendingLogins.find(guid);
+	if (it == pendingLogins.end()) {
+		return false;
+	}
+
+	bool stale = it->second.lastWrite > token;
+	if (--it->second.count == 0) {
+		pendingLogins.erase(it);
+	}
+	return stale;
+}
+
+void IOLoginData::notifyPlayerWrite(uint32_t guid)
+{
+	if (auto it = pendingLogins.find(guid); it != pendingLogins.end()) {
+		it->second.lastWrite = ++lastWrite;
+	}
+}
+
+void IOLoginData::notifyUnknownWrite()
+{
+	for (auto& it : pendingLogins) {
+		it.second.lastWrite = ++lastWrite;
+	}
+}
+
+void IOLoginData::fetchPlayerTables(Database& db, PlayerLoadData& data)
+{
+	uint32_t guid = data.player->getNumber<uint32_t>("id");
+	uint32_t accountId = data.player->getNumber<uint32_t>("account_id");
+
+	data.account = queryAccount(db, accountId);
+	data.guildMembership = db.storeQuery(fmt::format(
+	    "SELECT `guild_id`, `rank_id`, `nick` FROM `guild_membership` WHERE `player_id` = {:d}", guid));
+	data.spells =
+	    db.storeQuery(fmt::format("SELECT `player_id`, `name` FROM `player_spells` WHERE `player_id` = {:d}", guid));
+	data.items = db.storeQuery(fmt::format(
+	    "SELECT `pid`, `sid`, `itemtype`, `count`, `attributes` FROM `player_items` WHERE `player_id` = {:d} ORDER BY `sid` DESC",
+	    guid));
+	data.storages =
+	    db.storeQuery(fmt::format("SELECT `key`, `value` FROM `player_storage` WHERE `player_id` = {:d}", guid));
+	data.vipList =
+	    db.storeQuery(fmt::format("SELECT `player_id` FROM `account_viplist` WHERE `account_id` = {:d}", accountId));
+	data.outfits = db.storeQuery(
+	    fmt::format("SELECT `outfit_id`, `addons` FROM `player_outfits` WHERE `player_id` = {:d}", guid));
+	data.mounts = db.storeQuery(fmt::format("SELECT `mount_id` FROM `player_mounts` WHERE `player_id` = {:d}", guid));
 }
 
 static GuildWarVector getWarList(uint32_t guildId)
@@ -299,10 +384,23 @@ bool IOLoginData::loadPlayer(Player* player, DBResult_ptr result)
 		return false;
 	}
 
+	PlayerLoadData data;
+	data.player = std::move(result);
+	fetchPlayerTables(Database::getInstance(), data);
+	return loadPlayer(player, data);
+}
+
+bool IOLoginData::loadPlayer(Player* player, const PlayerLoadData& data)
+{
+	DBResult_ptr result = data.player;
+	if (!result) {
+		return false;
+	}
+
 	Database& db = Database::getInstance();
 
 	uint32_t accno = result->getNumber<uint32_t>("account_id");
-	Account acc = loadAccount(accno);
+	Account acc = readAccount(data.account);
 
 	player->setGUID(result->getNumber<uint32_t>("id"));
 	player->name = result->getString("name");
@@ -467,9 +565,7 @@ bool IOLoginData::loadPlayer(Player* player, DBResult_ptr result)
 		player->skills[i].percent = static_cast<uint16_t>(percent);
 	}
 
-	if ((result = db.storeQuery(
-	         fmt::format("SELECT `guild_id`, `rank_id`, `nick` FROM `guild_membership` WHERE `player_id` = {:d}",
-	                     player->getGUID())))) {
+	if ((result = data.guildMembership)) {
 		uint32_t guildId = result->getNumber<uint32_t>("guild_id");
 		uint32_t playerRankId = result->getNumber<uint32_t>("rank_id");
 		player->guildNick = result->getString("nick");
@@ -512,8 +608,7 @@ bool IOLoginData::loadPlayer(Player* player, DBResult_ptr result)
 		}
 	}
 
-	if ((result = db.storeQuery(fmt::format("SELECT `player_id`, `name` FROM `player_spells` WHERE `player_id` = {:d}",
-	                                        player->getGUID())))) {
+	if ((result = data.spells)) {
 		do {
 			player->learnedInstantSpellList.emplace_front(result->getString("name"));
 		} while (result->next());
@@ -522,9 +617,7 @@ bool IOLoginData::loadPlayer(Player* player, DBResult_ptr result)
 	// load inventory items
 	ItemMap itemMap;
 
-	if ((result = db.storeQuery(fmt::format(
-	         "SELECT `pid`, `sid`, `itemtype`, `count`, `attributes` FROM `player_items` WHERE `player_id` = {:d} ORDER BY `sid` DESC",
-	         player->getGUID())))) {
+	if ((result = data.items)) {
 		loadItems(itemMap, result);
 
 		for (ItemMap::const_reverse_iterator it = itemMap.rbegin(), end = itemMap.rend(); it != end; ++it) {
@@ -548,135 +641,22 @@ bool IOLoginData::loadPlayer(Player* player, DBResult_ptr result)
 		}
 	}
 
-	// load depot locker items
-	itemMap.clear();
-
-	if ((result = db.storeQuery(fmt::format(
-	         "SELECT `pid`, `sid`, `itemtype`, `count`, `attributes` FROM `player_depotlockeritems` WHERE `player_id` = {:d} ORDER BY `sid` DESC",
-	         player->getGUID())))) {
-		loadItems(itemMap, result);
-
-		for (ItemMap::const_reverse_iterator it = itemMap.rbegin(), end = itemMap.rend(); it != end; ++it) {
-			const std::pair<Item*, int32_t>& pair = it->second;
-			Item* item = pair.first;
-
-			int32_t pid = pair.second;
-			if (pid >= 0 && pid < 100) {
-				DepotLocker* depotLocker = player->getDepotLocker(pid);
-				if (depotLocker) {
-					depotLocker->internalAddThing(item);
-				}
-			} else {
-				ItemMap::const_iterator it2 = itemMap.find(pid);
-				if (it2 == itemMap.end()) {
-					continue;
-				}
-
-				Container* container = it2->second.first->getContainer();
-				if (container) {
-					container->internalAddThing(item);
-				}
-			}
-		}
-	}
-
-	// load depot items
-	itemMap.clear();
-
-	if ((result = db.storeQuery(fmt::format(
-	         "SELECT `pid`, `sid`, `itemtype`, `count`, `attributes` FROM `player_depotitems` WHERE `player_id` = {:d} ORDER BY `sid` DESC",
-	         player->getGUID())))) {
-		loadItems(itemMap, result);
-
-		for (ItemMap::const_reverse_iterator it = itemMap.rbegin(), end = itemMap.rend(); it != end; ++it) {
-			const std::pair<Item*, int32_t>& pair = it->second;
-			Item* item = pair.first;
-
-			int32_t pid = pair.second;
-			if (pid >= 0 && pid < 100) {
-				DepotChest* depotChest = player->getDepotChest(pid, true);
-				if (depotChest) {
-					depotChest->internalAddThing(item);
-				}
-			} else {
-				ItemMap::const_iterator it2 = itemMap.find(pid);
-				if (it2 == itemMap.end()) {
-					continue;
-				}
-
-				Container* container = it2->second.first->getContainer();
-				if (container) {
-					container->internalAddThing(item);
-				}
-			}
-		}
-	}
-
-	// Load reward items
-	itemMap.clear();
-
-	if ((result = db.storeQuery(fmt::format("SELECT `sid`, `pid`, `itemtype`, `count`, `attributes` FROM `player_rewarditems` WHERE `player_id` = {:d} ORDER BY `sid` DESC", player->getGUID())))) {
-		loadItems(itemMap, result);
-
-		// Map to store containers (bags) for each unique DATE attribute
-		std::unordered_map<int64_t, Container*> dateContainers;
-
-		// Get the current time and calculate the time 7 days ago
-		time_t now = std::time(nullptr);
-		time_t seven_days_ago = now - (7 * 24 * 60 * 60); // 7 days in seconds
-		
-
-		for (ItemMap::const_reverse_iterator it = itemMap.rbegin(), end = itemMap.rend(); it != end; ++it) {
-			const std::pair<Item*, uint32_t>& pair = it->second;
-			Item* item = pair.first;
-
-			int64_t rewardDate = item->getIntAttr(ITEM_ATTRIBUTE_DATE);
-
-			// Skip items older than 7 days
-			if (rewardDate < static_cast<int64_t>(seven_days_ago)) {
-				continue;
-			}
-
-			// Create or get existing container for the given DATE attribute
-			Container* container = nullptr;
-			auto containerIt = dateContainers.find(rewardDate);
-			if (containerIt != dateContainers.end()) {
-				container = containerIt->second;
-			}
-			else {
-				container = new Container(ITEM_REWARD_CONTAINER);
-				container->setIntAttr(ITEM_ATTRIBUTE_DATE, rewardDate); // Set the DATE attribute on the container
-				container->setIntAttr(ITEM_ATTRIBUTE_REWARDID, item->getIntAttr(ITEM_ATTRIBUTE_REWARDID));
-				dateContainers[rewardDate] = container;
-			}
-
-			container->internalAddThing(item);
-		}
-
-		for (auto& pair : dateContainers) {
-			player->getRewardChest().internalAddThing(pair.second);
-		}
-	}
-
 	// load storage map
-	if ((result = db.storeQuery(
-	         fmt::format("SELECT `key`, `value` FROM `player_storage` WHERE `player_id` = {:d}", player->getGUID())))) {
+	if ((result = data.storages)) {
 		do {
 			player->setStorageValue(result->getNumber<uint32_t>("key"), result->getNumber<int64_t>("value"), true);
 		} while (result->next());
 	}
 
 	// load vip list
-	if ((result = db.storeQuery(fmt::format("SELECT `player_id` FROM `account_viplist` WHERE `account_id` = {:d}",
-	                                        player->getAccount())))) {
+	if ((result = data.vipList)) {
 		do {
 			player->addVIPInternal(result->getNumber<uint32_t>("player_id"));
 		} while (result->next());
 	}
 
 	// load outfits & addons
-	if ((result = db.storeQuery(fmt::format(
-	         "SELECT `outfit_id`, `addons` FROM `player_outfits` WHERE `player_id` = {:d}", player->getGUID())))) {
+	if ((result = data.outfits)) {
 		do {
 			player->addOutfit(result->getNumber<uint16_t>("outfit_id"),
 			                  static_cast<uint8_t>(result->getNumber<uint16_t>("addons")));
@@ -684,8 +664,7 @@ bool IOLoginData::loadPlayer(Player* player, DBResult_ptr result)
 	}
 
 	// load mounts
-	if ((result = db.storeQuery(
-	         fmt::format("SELECT `mount_id` FROM `player_mounts` WHERE `player_id` = {:d}", player->getGUID())))) {
+	if ((result = data.mounts)) {
 		do {
 			player->tameMount(result->getNumber<uint16_t>("mount_id"));
 		} while (result->next());
@@ -806,12 +785,133 @@ bool IOLoginData::addRewardItems(uint32_t playerId, const ItemBlockList& itemLis
     return query_insert.execute();
 }
 
+void IOLoginData::loadPlayerDepot(Player* player)
+{
+	Database& db = Database::getInstance();
+
+	// load depot locker items
+	ItemMap itemMap;
+	DBResult_ptr result;
+	if ((result = db.storeQuery(fmt::format(
+	         "SELECT `pid`, `sid`, `itemtype`, `count`, `attributes` FROM `player_depotlockeritems` WHERE `player_id` = {:d} ORDER BY `sid` DESC",
+	         player->getGUID())))) {
+		loadItems(itemMap, result);
+
+		for (ItemMap::const_reverse_iterator it = itemMap.rbegin(), end = itemMap.rend(); it != end; ++it) {
+			const std::pair<Item*, int32_t>& pair = it->second;
+			Item* item = pair.first;
+
+			int32_t pid = pair.second;
+			if (pid >= 0 && pid < 100) {
+				DepotLocker* depotLocker = player->getDepotLocker(pid);
+				if (depotLocker) {
+					depotLocker->internalAddThing(item);
+				}
+			} else {
+				ItemMap::const_iterator it2 = itemMap.find(pid);
+				if (it2 == itemMap.end()) {
+					continue;
+				}
+
+				Container* container = it2->second.first->getContainer();
+				if (container) {
+					container->internalAddThing(item);
+				}
+			}
+		}
+	}
+
+	// load depot items
+	itemMap.clear();
+
+	if ((result = db.storeQuery(fmt::format(
+	         "SELECT `pid`, `sid`, `itemtype`, `count`, `attributes` FROM `player_depotitems` WHERE `player_id` = {:d} ORDER BY `sid` DESC",
+	         player->getGUID())))) {
+		loadItems(itemMap, result);
+
+		for (ItemMap::const_reverse_iterator it = itemMap.rbegin(), end = itemMap.rend(); it != end; ++it) {
+			const std::pair<Item*, int32_t>& pair = it->second;
+			Item* item = pair.first;
+
+			int32_t pid = pair.second;
+			if (pid >= 0 && pid < 100) {
+				DepotChest* depotChest = player->getDepotChest(pid, true);
+				if (depotChest) {
+					depotChest->internalAddThing(item);
+				}
+			} else {
+				ItemMap::const_iterator it2 = itemMap.find(pid);
+				if (it2 == itemMap.end()) {
+					continue;
+				}
+
+				Container* container = it2->second.first->getContainer();
+				if (container) {
+					container->internalAddThing(item);
+				}
+			}
+		}
+	}
+}
+
+void IOLoginData::loadPlayerRewardChest(Player* player)
+{
+	Database& db = Database::getInstance();
+
+	ItemMap itemMap;
+	DBResult_ptr result;
+	if ((result = db.storeQuery(fmt::format("SELECT `sid`, `pid`, `itemtype`, `count`, `attributes` FROM `player_rewarditems` WHERE `player_id` = {:d} ORDER BY `sid` DESC", player->getGUID())))) {
+		loadItems(itemMap, result);
+
+		// Map to store containers (bags) for each unique DATE attribute
+		std::unordered_map<int64_t, Container*> dateContainers;
+
+		// Get the current time and calculate the time 7 days ago
+		time_t now = std::time(nullptr);
+		time_t seven_days_ago = now - (7 * 24 * 60 * 60); // 7 days in seconds
+		
+
+		for (ItemMap::const_reverse_iterator it = itemMap.rbegin(), end = itemMap.rend(); it != end; ++it) {
+			const std::pair<Item*, uint32_t>& pair = it->second;
+			Item* item = pair.first;
+
+			int64_t rewardDate = item->getIntAttr(ITEM_ATTRIBUTE_DATE);
+
+			// Skip items older than 7 days
+			if (rewardDate < static_cast<int64_t>(seven_days_ago)) {
+				continue;
+			}
+
+			// Create or get existing container for the given DATE attribute
+			Container* container = nullptr;
+			auto containerIt = dateContainers.find(rewardDate);
+			if (containerIt != dateContainers.end()) {
+				container = containerIt->second;
+			}
+			else {
+				container = new Container(ITEM_REWARD_CONTAINER);
+				container->setIntAttr(ITEM_ATTRIBUTE_DATE, rewardDate); // Set the DATE attribute on the container
+				container->setIntAttr(ITEM_ATTRIBUTE_REWARDID, item->getIntAttr(ITEM_ATTRIBUTE_REWARDID));
+				dateContainers[rewardDate] = container;
+			}
+
+			container->internalAddThing(item);
+		}
+
+		for (auto& pair : dateContainers) {
+			player->getRewardChest().internalAddThing(pair.second);
+		}
+	}
+}
+
 bool IOLoginData::savePlayer(Player* player)
 {
 	if (player->isDead()) {
 		player->changeHealth(1);
 	}
 
+	notifyPlayerWrite(player->getGUID());
+
 	Database& db = Database::getInstance();
 
 	DBResult_ptr result =
@@ -1021,45 +1121,36 @@ bool IOLoginData::savePlayer(Player* player)
 		}
 	}
 
-	// save reward items
-	if (!db.executeQuery(fmt::format("DELETE FROM `player_rewarditems` WHERE `player_id` = {:d}", player->getGUID()))) {
-		return false;
-	}
+	// save reward items, the reward chest only exists once it was loaded
+	if (player->rewardChest) {
+		if (!db.executeQuery(fmt::format("DELETE FROM `player_rewarditems` WHERE `player_id` = {:d}", player->getGUID()))) {
+			return false;
+		}
 
-	DBInsert rewardQuery("INSERT INTO `player_rewarditems` (`player_id`, `pid`, `sid`, `itemtype`, `count`, `attributes`) VALUES ");
-	itemList.clear();
+		DBInsert rewardQuery("INSERT INTO `player_rewarditems` (`player_id`, `pid`, `sid`, `itemtype`, `count`, `attributes`) VALUES ");
+		itemList.clear();
 
-	int32_t pidCounter = 1;
+		int32_t pidCounter = 1;
 
-	for (Item* item : player->getRewardChest().getItemList()) {
-		if (Container* container = item->getContainer()) {
-			int32_t currentPid = pidCounter++;
-			for (Item* subItem : container->getItemList()) {
-				itemList.emplace_back(currentPid, subItem);
+		for (Item* item : player->getRewardChest().getItemList()) {
+			if (Container* container = item->getContainer()) {
+				int32_t currentPid = pidCounter++;
+				for (Item* subItem : container->getItemList()) {
+					itemList.emplace_back(currentPid, subItem);
+				}
+			}
+			else {
+				itemList.emplace_back(0, item);
 			}
 		}
-		else {
-			itemList.emplace_back(0, item);
-		}
-	}
-
-	if (!saveItems(player, itemList, rewardQuery, propWriteStream)) {
-		return false;
-	}
-
-	if (!db.executeQuery(fmt::format("DELETE FROM `player_storage` WHERE `player_id` = {:d}", player->getGUID()))) {
-		return false;
-	}
-
-	DBInsert storageQuery("INSERT INTO `player_storage` (`player_id`, `key`, `value`) VALUES ");
 
-	for (const auto& [key, value] : player->getStorageMap()) {
-		if (!storageQuery.addRow(fmt::format("{:d}, {:d}, {:d}", player->getGUID(), key, value))) {
+		if (!saveItems(player, itemList, rewardQuery, propWriteStream)) {
 			return false;
 		}
 	}
 
-	if (!storageQuery.execute()) {
+	// only storages changed since the last save are written
+	if (!saveChangedStorages(player->getStorageMap(), "player_storage", "player_id", player->getGUID())) {
 		return false;
 	}
 
@@ -1098,7 +1189,12 @@ bool IOLoginData::savePlayer(Player* player)
 	}
 
 	// End the transaction
-	return transaction.commit();
+	if (!transaction.commit()) {
+		return false;
+	}
+
+	player->clearDirtyStorages();
+	return true;
 }
 
 std::string_view IOLoginData::getNameByGuid(uint32_t guid)
@@ -1188,6 +1284,7 @@ void IOLoginData::loadItems(ItemMap& itemMap, DBResult_ptr result)
 
 void IOLoginData::increaseBankBalance(uint32_t guid, uint64_t bankBalance)
 {
+	notifyPlayerWrite(guid);
 	Database::getInstance().executeQuery(
 	    fmt::format("UPDATE `players` SET `balance` = `balance` + {:d} WHERE `id` = {:d}", bankBalance, guid));
 }
@@ -10,6 +10,24 @@
 
 using ItemBlockList = std::list<std::pair<int32_t, Item*>>;
 
+// Query results of everything loadPlayer reads from the database. Login fetches them on the database thread so the
+// dispatcher only has to build the player.
+struct PlayerLoadData
+{
+	DBResult_ptr player;
+	DBResult_ptr account;
+	DBResult_ptr guildMembership;
+	DBResult_ptr spells;
+	DBResult_ptr items;
+	DBResult_ptr storages;
+	DBResult_ptr vipList;
+	DBResult_ptr outfits;
+	DBResult_ptr mounts;
+
+	// milliseconds spent running the queries
+	int64_t fetchTime = 0;
+};
+
 class IOLoginData
 {
 public:
@@ -30,6 +48,20 @@ public:
 	static bool loadPlayerById(Player* player, uint32_t id);
 	static bool loadPlayerByName(Player* player, std::string_view name);
 	static bool loadPlayer(Player* player, DBResult_ptr result);
+	static bool loadPlayer(Player* player, const PlayerLoadData& data);
+	// runs the queries of loadPlayerById on db, safe to call from the database thread
+	static PlayerLoadData fetchPlayerById(Database& db, uint32_t id);
+	// brackets a fetchPlayerById on the database thread, endLogin tells whether the player's rows were written in
+	// between and the fetched data is stale; a save of the logged in player would write the old rows back
+	static uint64_t beginLogin(uint32_t guid);
+	static bool endLogin(uint32_t guid, uint64_t token);
+	// called by everything that writes the rows of a player who might be logging in
+	static void notifyPlayerWrite(uint32_t guid);
+	// raw queries from scripts, any login in progress is treated as stale
+	static void notifyUnknownWrite();
+	// depot and reward chest contents are loaded on first access, see Player::getDepotLocker and getRewardChest
+	static void loadPlayerDepot(Player* player);
+	static void loadPlayerRewardChest(Player* player);
 	static bool savePlayer(Player* player);
 	static bool addRewardItems(uint32_t playerId, const ItemBlockList& itemList, DBInsert& query_insert, PropWriteStream& propWriteStream);
 	static uint32_t getGuidByName(std::string_view name);
@@ -61,6 +93,7 @@ private:
 	using ItemMap = std::map<uint32_t, std::pair<Item*, uint32_t>>;
 
 	static void loadItems(ItemMap& itemMap, DBResult_ptr result);
+	static void fetchPlayerTables(Database& db, PlayerLoadData& data);
 	static bool saveItems(const Player* player, const ItemBlockList& itemList, DBInsert& query_insert,
 	                      PropWriteStream& propWriteStream);
 };
@@ -47,17 +47,75 @@ Tile* IOMap::createTile(Item*& ground, Item* item, uint16_t x, uint16_t y, uint8
 	}
 
 	tile->internalAddThing(ground);
-	ground->startDecaying();
 	ground = nullptr;
 	return tile;
 }
 
+struct IOMap::TileAreaBuffer
+{
+	struct HouseTileEntry
+	{
+		uint32_t houseId;
+		uint16_t x;
+		uint16_t y;
+		uint8_t z;
+		uint32_t flags;
+		std::vector<Item*> items;
+	};
+
+	std::vector<Tile*> tiles;
+	std::vector<HouseTileEntry> houseTiles;
+	// items in the order the serial loader started their decay
+	std::vector<Item*> decayItems;
+	// unique ids and bed sleepers, registered with the game and printed by the merge
+	Item::MapLoadRegistrations registrations;
+	std::vector<std::string> warnings;
+	std::string error;
+};
+
+namespace {
+
+// items decoded on this thread collect their registrations in a tile area buffer
+class MapLoadRegistrationScope
+{
+public:
+	explicit MapLoadRegistrationScope(Item::MapLoadRegistrations& registrations)
+	{
+		Item::mapLoadRegistrations = &registrations;
+	}
+	~MapLoadRegistrationScope() { Item::mapLoadRegistrations = nullptr; }
+
+	// non-copyable
+	MapLoadRegistrationScope(const MapLoadRegistrationScope&) = delete;
+	MapLoadRegistrationScope& operator=(const MapLoadRegistrationScope&) = delete;
+};
+
+// drops the registrations of an item deleted before the merge, and of the items inside it
+void forgetRegistrations(Item::MapLoadRegistrations& registrations, const Item* item)
+{
+	auto isInside = [item](const Item* registered) {
+		for (const Thing* thing = registered; thing; thing = thing->getParent()) {
+			if (thing == item) {
+				return true;
+			}
+		}
+		return false;
+	};
+
+	std::erase_if(registrations.uniqueIds, [&](const auto& entry) { return isInside(entry.first); });
+	std::erase_if(registrations.bedSleepers, [&](const auto& entry) { return isInside(entry.first); });
+}
+
+} // namespace
+
 bool IOMap::loadMap(Map* map, const std::filesystem::path& fileName)
 {
 	int64_t start = OTSYS_TIME();
+	metrics = {};
 	try {
 		OTB::Loader loader{fileName.string(), OTB::Identifier{{'O', 'T', 'B', 'M'}}};
 		auto& root = loader.parseTree();
+		metrics.parseTree = OTSYS_TIME() - start;
 
 		PropStream propStream;
 		if (!loader.getProps(root, propStream)) {
@@ -122,11 +180,33 @@ bool IOMap::loadMap(Map* map, const std::filesystem::path& fileName)
 			return false;
 		}
 
+		std::vector<const OTB::Node*> tileAreaNodes;
 		for (auto& mapDataNode : mapNode.children) {
 			if (mapDataNode.type == OTBM_TILE_AREA) {
-				if (!parseTileArea(loader, mapDataNode, *map)) {
-					return false;
-				}
+				tileAreaNodes.push_back(&mapDataNode);
+			}
+		}
+
+		std::vector<TileAreaBuffer> buffers(tileAreaNodes.size());
+		int64_t decodeStart = OTSYS_TIME();
+		if (!decodeTileAreas(loader, tileAreaNodes, buffers)) {
+			return false;
+		}
+
+		int64_t mergeStart = OTSYS_TIME();
+		metrics.decodeTileAreas = mergeStart - decodeStart;
+		metrics.tileAreas = tileAreaNodes.size();
+
+		for (auto& buffer : buffers) {
+			if (!mergeTileArea(buffer, *map)) {
+				return false;
+			}
+		}
+		metrics.mergeTileAreas = OTSYS_TIME() - mergeStart;
+
+		for (auto& mapDataNode : mapNode.children) {
+			if (mapDataNode.type == OTBM_TILE_AREA) {
+				continue;
 			} else if (mapDataNode.type == OTBM_TOWNS) {
 				if (!parseTowns(loader, mapDataNode, *map)) {
 					return false;
@@ -145,7 +225,12 @@ bool IOMap::loadMap(Map* map, const std::filesystem::path& fileName)
 		return false;
 	}
 	
-	g_logger().info("Map loading time: {} seconds ", (OTSYS_TIME() - start) / (1000.));
+	metrics.total = OTSYS_TIME() - start;
+	g_logger().info("Map loading time: {} seconds ", metrics.total / (1000.));
+	g_logger().info("Map loading phases: tree {} ms, {} tile areas ({} tiles) decoded in {} ms on {} threads, "
+	                "merged in {} ms",
+	                metrics.parseTree, metrics.tileAreas, metrics.tiles, metrics.decodeTileAreas, metrics.threads,
+	                metrics.mergeTileAreas);
 	return true;
 }
 
@@ -200,17 +285,57 @@ bool IOMap::parseMapDataAttributes(OTB::Loader& loader, const OTB::Node& mapNode
 	return true;
 }
 
-bool IOMap::parseTileArea(OTB::Loader& loader, const OTB::Node& tileAreaNode, Map& map)
+bool IOMap::decodeTileAreas(OTB::Loader& loader, const std::vector<const OTB::Node*>& tileAreaNodes,
+                            std::vector<TileAreaBuffer>& buffers)
+{
+	size_t threads = threadCount != 0 ? threadCount : std::max<size_t>(1, std::thread::hardware_concurrency());
+	threads = std::max<size_t>(1, std::min(threads, tileAreaNodes.size()));
+	metrics.threads = threads;
+
+	// every thread takes the next undecoded area, buffers keep file order for the merge
+	std::atomic<size_t> nextArea{0};
+	std::atomic<bool> failed{false};
+	auto decode = [&]() {
+		size_t index;
+		while (!failed && (index = nextArea++) < tileAreaNodes.size()) {
+			MapLoadRegistrationScope registrationScope{buffers[index].registrations};
+			if (!parseTileArea(loader, *tileAreaNodes[index], buffers[index])) {
+				failed = true;
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+	workers.reserve(threads - 1);
+	for (size_t i = 1; i < threads; ++i) {
+		workers.emplace_back(decode);
+	}
+	decode();
+
+	for (auto& worker : workers) {
+		worker.join();
+	}
+
+	for (auto& buffer : buffers) {
+		if (!buffer.error.empty()) {
+			setLastErrorString(buffer.error);
+			return false;
+		}
+	}
+	return !failed;
+}
+
+bool IOMap::parseTileArea(OTB::Loader& loader, const OTB::Node& tileAreaNode, TileAreaBuffer& buffer)
 {
 	PropStream propStream;
 	if (!loader.getProps(tileAreaNode, propStream)) {
-		setLastErrorString("Invalid map node.");
+		buffer.error = "Invalid map node.";
 		return false;
 	}
 
 	OTBM_Destination_coords area_coord;
 	if (!propStream.read(area_coord)) {
-		setLastErrorString("Invalid map node.");
+		buffer.error = "Invalid map node.";
 		return false;
 	}
 
@@ -220,26 +345,26 @@ bool IOMap::parseTileArea(OTB::Loader& loader, const OTB::Node& tileAreaNode, Ma
 
 	for (auto& tileNode : tileAreaNode.children) {
 		if (tileNode.type != OTBM_TILE && tileNode.type != OTBM_HOUSETILE) {
-			setLastErrorString("Unknown tile node.");
+			buffer.error = "Unknown tile node.";
 			return false;
 		}
 
 		if (!loader.getProps(tileNode, propStream)) {
-			setLastErrorString("Could not read node data.");
+			buffer.error = "Could not read node data.";
 			return false;
 		}
 
 		OTBM_Tile_coords tile_coord;
 		if (!propStream.read(tile_coord)) {
-			setLastErrorString("Could not read tile position.");
+			buffer.error = "Could not read tile position.";
 			return false;
 		}
 
 		uint16_t x = base_x + tile_coord.x;
 		uint16_t y = base_y + tile_coord.y;
 
-		bool isHouseTile = false;
-		House* house = nullptr;
+		// houses are shared between areas, house tiles are only created when merging
+		TileAreaBuffer::HouseTileEntry* houseTile = nullptr;
 		Tile* tile = nullptr;
 		Item* ground_item = nullptr;
 		uint32_t tileflags = TILESTATE_NONE;
@@ -247,21 +372,54 @@ bool IOMap::parseTileArea(OTB::Loader& loader, const OTB::Node& tileAreaNode, Ma
 		if (tileNode.type == OTBM_HOUSETILE) {
 			uint32_t houseId;
 			if (!propStream.read<uint32_t>(houseId)) {
-				setLastErrorString(fmt::format("[x:{:d}, y:{:d}, z:{:d}] Could not read house id.", x, y, z));
+				buffer.error = fmt::format("[x:{:d}, y:{:d}, z:{:d}] Could not read house id.", x, y, z);
 				return false;
 			}
 
-			house = map.houses.addHouse(houseId);
-			if (!house) {
-				setLastErrorString(
-				    fmt::format("[x:{:d}, y:{:d}, z:{:d}] Could not create house id: {:d}", x, y, z, houseId));
-				return false;
+			houseTile = &buffer.houseTiles.emplace_back();
+			houseTile->houseId = houseId;
+			houseTile->x = x;
+			houseTile->y = y;
+			houseTile->z = static_cast<uint8_t>(z);
+		}
+
+		auto addItem = [&](Item* item) {
+			if (houseTile && item->isMoveable()) {
+				buffer.warnings.push_back(fmt::format(
+				    "[Warning - IOMap::loadMap] Moveable item with ID: {:d}, in house: {:d}, at position [x: {:d}, y: "
+				    "{:d}, z: {:d}].",
+				    item->getID(), houseTile->houseId, x, y, z));
+				forgetRegistrations(buffer.registrations, item);
+				delete item;
+				return;
 			}
 
-			tile = new HouseTile(x, y, z, house);
-			house->addTile(static_cast<HouseTile*>(tile));
-			isHouseTile = true;
-		}
+			if (item->getItemCount() == 0) {
+				item->setItemCount(1);
+			}
+
+			if (houseTile) {
+				houseTile->items.push_back(item);
+			} else if (tile) {
+				tile->internalAddThing(item);
+				buffer.decayItems.push_back(item);
+				item->setLoadedFromMap(true);
+			} else if (item->isGroundTile()) {
+				if (ground_item) {
+					forgetRegistrations(buffer.registrations, ground_item);
+					delete ground_item;
+				}
+				ground_item = item;
+			} else {
+				if (ground_item) {
+					buffer.decayItems.push_back(ground_item);
+				}
+				tile = createTile(ground_item, item, x, y, z);
+				tile->internalAddThing(item);
+				buffer.decayItems.push_back(item);
+				item->setLoadedFromMap(true);
+			}
+		};
 
 		uint8_t attribute;
 		// read tile attributes
@@ -270,7 +428,7 @@ bool IOMap::parseTileArea(OTB::Loader& loader, const OTB::Node& tileAreaNode, Ma
 				case OTBM_ATTR_TILE_FLAGS: {
 					uint32_t flags;
 					if (!propStream.read<uint32_t>(flags)) {
-						setLastErrorString(fmt::format("[x:{:d}, y:{:d}, z:{:d}] Failed to read tile flags.", x, y, z));
+						buffer.error = fmt::format("[x:{:d}, y:{:d}, z:{:d}] Failed to read tile flags.", x, y, z);
 						return false;
 					}
 
@@ -291,102 +449,113 @@ bool IOMap::parseTileArea(OTB::Loader& loader, const OTB::Node& tileAreaNode, Ma
 				case OTBM_ATTR_ITEM: {
 					Item* item = Item::CreateItem(propStream);
 					if (!item) {
-						setLastErrorString(fmt::format("[x:{:d}, y:{:d}, z:{:d}] Failed to create item.", x, y, z));
+						buffer.error = fmt::format("[x:{:d}, y:{:d}, z:{:d}] Failed to create item.", x, y, z);
 						return false;
 					}
 
-					if (isHouseTile && item->isMoveable()) {
-						std::cout << "[Warning - IOMap::loadMap] Moveable item with ID: " << item->getID()
-						          << ", in house: " << house->getId() << ", at position [x: " << x << ", y: " << y
-						          << ", z: " << z << "]." << std::endl;
-						delete item;
-					} else {
-						if (item->getItemCount() == 0) {
-							item->setItemCount(1);
-						}
-
-						if (tile) {
-							tile->internalAddThing(item);
-							item->startDecaying();
-							item->setLoadedFromMap(true);
-						} else if (item->isGroundTile()) {
-							delete ground_item;
-							ground_item = item;
-						} else {
-							tile = createTile(ground_item, item, x, y, z);
-							tile->internalAddThing(item);
-							item->startDecaying();
-							item->setLoadedFromMap(true);
-						}
-					}
+					addItem(item);
 					break;
 				}
 
 				default:
-					setLastErrorString(fmt::format("[x:{:d}, y:{:d}, z:{:d}] Unknown tile attribute.", x, y, z));
+					buffer.error = fmt::format("[x:{:d}, y:{:d}, z:{:d}] Unknown tile attribute.", x, y, z);
 					return false;
 			}
 		}
 
 		for (auto& itemNode : tileNode.children) {
 			if (itemNode.type != OTBM_ITEM) {
-				setLastErrorString(fmt::format("[x:{:d}, y:{:d}, z:{:d}] Unknown node type.", x, y, z));
+				buffer.error = fmt::format("[x:{:d}, y:{:d}, z:{:d}] Unknown node type.", x, y, z);
 				return false;
 			}
 
 			PropStream stream;
 			if (!loader.getProps(itemNode, stream)) {
-				setLastErrorString("Invalid item node.");
+				buffer.error = "Invalid item node.";
 				return false;
 			}
 
 			Item* item = Item::CreateItem(stream);
 			if (!item) {
-				setLastErrorString(fmt::format("[x:{:d}, y:{:d}, z:{:d}] Failed to create item.", x, y, z));
+				buffer.error = fmt::format("[x:{:d}, y:{:d}, z:{:d}] Failed to create item.", x, y, z);
 				return false;
 			}
 
 			if (!item->unserializeItemNode(loader, itemNode, stream)) {
-				setLastErrorString(
-				    fmt::format("[x:{:d}, y:{:d}, z:{:d}] Failed to load item {:d}.", x, y, z, item->getID()));
+				buffer.error =
+				    fmt::format("[x:{:d}, y:{:d}, z:{:d}] Failed to load item {:d}.", x, y, z, item->getID());
 				delete item;
 				return false;
 			}
 
-			if (isHouseTile && item->isMoveable()) {
-				std::cout << "[Warning - IOMap::loadMap] Moveable item with ID: " << item->getID()
-				          << ", in house: " << house->getId() << ", at position [x: " << x << ", y: " << y
-				          << ", z: " << z << "]." << std::endl;
-				delete item;
-			} else {
-				if (item->getItemCount() == 0) {
-					item->setItemCount(1);
-				}
+			addItem(item);
+		}
 
-				if (tile) {
-					tile->internalAddThing(item);
-					item->startDecaying();
-					item->setLoadedFromMap(true);
-				} else if (item->isGroundTile()) {
-					delete ground_item;
-					ground_item = item;
-				} else {
-					tile = createTile(ground_item, item, x, y, z);
-					tile->internalAddThing(item);
-					item->startDecaying();
-					item->setLoadedFromMap(true);
-				}
-			}
+		if (houseTile) {
+			houseTile->flags = tileflags;
+			continue;
 		}
 
 		if (!tile) {
+			if (ground_item) {
+				buffer.decayItems.push_back(ground_item);
+			}
 			tile = createTile(ground_item, nullptr, x, y, z);
 		}
 
 		tile->setFlag(static_cast<tileflags_t>(tileflags));
+		buffer.tiles.push_back(tile);
+	}
+	return true;
+}
+
+bool IOMap::mergeTileArea(TileAreaBuffer& buffer, Map& map)
+{
+	for (const auto& warning : buffer.warnings) {
+		std::cout << warning << std::endl;
+	}
+
+	// in file order, so the first item with a unique id keeps it, as with a serial load
+	for (const auto& [item, uniqueId] : buffer.registrations.uniqueIds) {
+		item->setUniqueId(uniqueId);
+	}
+
+	// looks the sleepers up in the database, which is only used from this thread
+	for (const auto& [bed, guid] : buffer.registrations.bedSleepers) {
+		bed->loadSleeper(guid);
+	}
+
+	for (Item* item : buffer.decayItems) {
+		item->startDecaying();
+	}
+
+	for (Tile* tile : buffer.tiles) {
+		const Position& position = tile->getPosition();
+		map.setTile(position.x, position.y, position.z, tile);
+	}
+
+	for (auto& entry : buffer.houseTiles) {
+		House* house = map.houses.addHouse(entry.houseId);
+		if (!house) {
+			setLastErrorString(fmt::format("[x:{:d}, y:{:d}, z:{:d}] Could not create house id: {:d}", entry.x,
+			                               entry.y, entry.z, entry.houseId));
+			return false;
+		}
+
+		HouseTile* tile = new HouseTile(entry.x, entry.y, entry.z, house);
+		house->addTile(tile);
 
-		map.setTile(x, y, z, tile);
+		for (Item* item : entry.items) {
+			tile->internalAddThing(item);
+			item->startDecaying();
+			item->setLoadedFromMap(true);
+		}
+
+		tile->setFlag(static_cast<tileflags_t>(entry.flags));
+		map.setTile(entry.x, entry.y, entry.z, tile);
 	}
+
+	metrics.tiles += buffer.tiles.size() + buffer.houseTiles.size();
 	return true;
 }
 
@@ -95,8 +95,25 @@ class IOMap
 	static Tile* createTile(Item*& ground, Item* item, uint16_t x, uint16_t y, uint8_t z);
 
 public:
+	// time spent in each phase of the last loadMap call, in milliseconds
+	struct LoadMetrics
+	{
+		int64_t parseTree = 0;
+		int64_t decodeTileAreas = 0;
+		int64_t mergeTileAreas = 0;
+		int64_t total = 0;
+		size_t threads = 0;
+		size_t tileAreas = 0;
+		size_t tiles = 0;
+	};
+
 	bool loadMap(Map* map, const std::filesystem::path& fileName);
 
+	const LoadMetrics& getLoadMetrics() const { return metrics; }
+
+	// number of threads decoding tile areas, 0 uses one per hardware thread
+	void setThreadCount(size_t count) { threadCount = count; }
+
 	/* Load the spawns
 	 * \param map pointer to the Map class
 	 * \returns Returns true if the spawns were loaded successfully
@@ -138,8 +155,17 @@ private:
 	                            const std::filesystem::path& fileName);
 	bool parseWaypoints(OTB::Loader& loader, const OTB::Node& waypointsNode, Map& map);
 	bool parseTowns(OTB::Loader& loader, const OTB::Node& townsNode, Map& map);
-	bool parseTileArea(OTB::Loader& loader, const OTB::Node& tileAreaNode, Map& map);
+
+	// tiles decoded from one tile area node, merged into the map once every area has been decoded
+	struct TileAreaBuffer;
+	static bool parseTileArea(OTB::Loader& loader, const OTB::Node& tileAreaNode, TileAreaBuffer& buffer);
+	bool decodeTileAreas(OTB::Loader& loader, const std::vector<const OTB::Node*>& tileAreaNodes,
+	                     std::vector<TileAreaBuffer>& buffers);
+	bool mergeTileArea(TileAreaBuffer& buffer, Map& map);
+
 	std::string errorString;
+	LoadMetrics metrics;
+	size_t threadCount = 0;
 };
 
 #endif
@@ -11,6 +11,7 @@
 #include "game.h"
 #include "house.h"
 #include "mailbox.h"
+#include "slab.h"
 #include "spells.h"
 #include "teleport.h"
 #include "trashholder.h"
@@ -20,7 +21,23 @@ extern Game g_game;
 extern Spells* g_spells;
 extern Vocations g_vocations;
 
+namespace {
+
+SlabAllocator& getItemAllocator()
+{
+	// never destroyed, items may still be released during static destruction
+	static auto* allocator = new SlabAllocator("Item", sizeof(Item));
+	return *allocator;
+}
+
+} // namespace
+
+void* Item::operator new(size_t size) { return getItemAllocator().allocate(size); }
+
+void Item::operator delete(void* p, size_t size) { getItemAllocator().deallocate(p, size); }
+
 Items Item::items;
+thread_local Item::MapLoadRegistrations* Item::mapLoadRegistrations = nullptr;
 
 Item* Item::CreateItem(const uint16_t type, uint16_t count /*= 0*/)
 {
@@ -194,9 +211,16 @@ bool Item::equals(const Item* otherItem) const
 	const auto& attributeList = attributes->attributes;
 	const auto& otherAttributeList = otherAttributes->attributes;
 	for (const auto& attribute : attributeList) {
-		if (ItemAttributes::isStrAttrType(attribute.type)) {
+		if (ItemAttributes::isSharedStrAttrType(attribute.type)) {
+			// interned, the pool holds a single entry per value
+			for (const auto& otherAttribute : otherAttributeList) {
+				if (attribute.type == otherAttribute.type && attribute.value.shared != otherAttribute.value.shared) {
+					return false;
+				}
+			}
+		} else if (ItemAttributes::isStrAttrType(attribute.type)) {
 			for (const auto& otherAttribute : otherAttributeList) {
-				if (attribute.type == otherAttribute.type && *attribute.value.string != *otherAttribute.value.string) {
+				if (attribute.type == otherAttribute.type && attribute.getString() != otherAttribute.getString()) {
 					return false;
 				}
 			}
@@ -626,7 +650,7 @@ Attr_ReadValue Item::readAttr(AttrTypes_t attr, PropStream& propStream)
 					return ATTR_READ_ERROR;
 				}
 
-				getAttributes()->reflect[combatType] = reflect;
+				getAttributes()->getCombatModifiers().reflect[combatType] = reflect;
 			}
 			break;
 		}
@@ -645,7 +669,7 @@ Attr_ReadValue Item::readAttr(AttrTypes_t attr, PropStream& propStream)
 					return ATTR_READ_ERROR;
 				}
 
-				getAttributes()->boostPercent[combatType] = percent;
+				getAttributes()->getCombatModifiers().boostPercent[combatType] = percent;
 			}
 			break;
 		}
@@ -892,32 +916,36 @@ void Item::serializeAttr(PropWriteStream& propWriteStream) const
 
 bool Item::hasProperty(ITEMPROPERTY prop) const
 {
-	const ItemType& it = items[id];
+	uint16_t flags = items.getPropertyFlags(id);
+	auto has = [flags](uint16_t flag) { return (flags & flag) != 0; };
 	switch (prop) {
 		case CONST_PROP_BLOCKSOLID:
-			return it.blockSolid;
+			return has(ITEMTYPE_FLAG_BLOCKSOLID);
 		case CONST_PROP_MOVEABLE:
-			return it.moveable && !hasAttribute(ITEM_ATTRIBUTE_UNIQUEID);
+			return has(ITEMTYPE_FLAG_MOVEABLE) && !hasAttribute(ITEM_ATTRIBUTE_UNIQUEID);
 		case CONST_PROP_HASHEIGHT:
-			return it.hasHeight;
+			return has(ITEMTYPE_FLAG_HASHEIGHT);
 		case CONST_PROP_BLOCKPROJECTILE:
-			return it.blockProjectile;
+			return has(ITEMTYPE_FLAG_BLOCKPROJECTILE);
 		case CONST_PROP_BLOCKPATH:
-			return it.blockPathFind;
+			return has(ITEMTYPE_FLAG_BLOCKPATHFIND);
 		case CONST_PROP_ISVERTICAL:
-			return it.isVertical;
+			return has(ITEMTYPE_FLAG_VERTICAL);
 		case CONST_PROP_ISHORIZONTAL:
-			return it.isHorizontal;
+			return has(ITEMTYPE_FLAG_HORIZONTAL);
 		case CONST_PROP_IMMOVABLEBLOCKSOLID:
-			return it.blockSolid && (!it.moveable || hasAttribute(ITEM_ATTRIBUTE_UNIQUEID));
+			return has(ITEMTYPE_FLAG_BLOCKSOLID) &&
+			       (!has(ITEMTYPE_FLAG_MOVEABLE) || hasAttribute(ITEM_ATTRIBUTE_UNIQUEID));
 		case CONST_PROP_IMMOVABLEBLOCKPATH:
-			return it.blockPathFind && (!it.moveable || hasAttribute(ITEM_ATTRIBUTE_UNIQUEID));
+			return has(ITEMTYPE_FLAG_BLOCKPATHFIND) &&
+			       (!has(ITEMTYPE_FLAG_MOVEABLE) || hasAttribute(ITEM_ATTRIBUTE_UNIQUEID));
 		case CONST_PROP_IMMOVABLENOFIELDBLOCKPATH:
-			return !it.isMagicField() && it.blockPathFind && (!it.moveable || hasAttribute(ITEM_ATTRIBUTE_UNIQUEID));
+			return !has(ITEMTYPE_FLAG_MAGICFIELD) && has(ITEMTYPE_FLAG_BLOCKPATHFIND) &&
+			       (!has(ITEMTYPE_FLAG_MOVEABLE) || hasAttribute(ITEM_ATTRIBUTE_UNIQUEID));
 		case CONST_PROP_NOFIELDBLOCKPATH:
-			return !it.isMagicField() && it.blockPathFind;
+			return !has(ITEMTYPE_FLAG_MAGICFIELD) && has(ITEMTYPE_FLAG_BLOCKPATHFIND);
 		case CONST_PROP_SUPPORTHANGABLE:
-			return it.isHorizontal || it.isVertical;
+			return has(ITEMTYPE_FLAG_HORIZONTAL) || has(ITEMTYPE_FLAG_VERTICAL);
 		default:
 			return false;
 	}
@@ -1026,6 +1054,11 @@ void Item::setUniqueId(uint16_t n)
 		return;
 	}
 
+	if (mapLoadRegistrations) {
+		mapLoadRegistrations->uniqueIds.emplace_back(this, n);
+		return;
+	}
+
 	if (g_game.addUniqueItem(n, this)) {
 		getAttributes()->setUniqueId(n);
 	}
@@ -1106,6 +1139,148 @@ double ItemAttributes::emptyDouble;
 bool ItemAttributes::emptyBool;
 Reflect ItemAttributes::emptyReflect;
 
+namespace {
+
+// live totals over every ItemAttributes instance, only read by ItemAttributes::getMemoryUsage
+std::atomic<uint64_t> liveAttributeLists{0};
+std::atomic<uint64_t> liveAttributes{0};
+std::atomic<uint64_t> heapAttributeLists{0};
+std::atomic<uint64_t> heapAttributeCapacity{0};
+
+} // namespace
+
+struct ItemAttributes::SharedStringPool
+{
+	std::mutex mutex;
+	std::unordered_map<std::string_view, std::unique_ptr<SharedString>> strings;
+};
+
+ItemAttributes::SharedStringPool& ItemAttributes::getSharedStringPool()
+{
+	// never destroyed, items may still release their strings during static destruction
+	static auto* pool = new SharedStringPool();
+	return *pool;
+}
+
+const ItemAttributes::SharedString* ItemAttributes::internString(std::string_view value)
+{
+	auto& pool = getSharedStringPool();
+	std::lock_guard<std::mutex> lockClass(pool.mutex);
+
+	auto it = pool.strings.find(value);
+	if (it == pool.strings.end()) {
+		auto string = std::make_unique<SharedString>(SharedString{std::string{value}, 0});
+		std::string_view key = string->value;
+		it = pool.strings.emplace(key, std::move(string)).first;
+	}
+
+	++it->second->references;
+	return it->second.get();
+}
+
+const ItemAttributes::SharedString* ItemAttributes::retainString(const SharedString* string)
+{
+	if (!string) {
+		return nullptr;
+	}
+
+	auto& pool = getSharedStringPool();
+	std::lock_guard<std::mutex> lockClass(pool.mutex);
+	++const_cast<SharedString*>(string)->references;
+	return string;
+}
+
+void ItemAttributes::releaseString(const SharedString* string)
+{
+	if (!string) {
+		return;
+	}
+
+	auto& pool = getSharedStringPool();
+	std::lock_guard<std::mutex> lockClass(pool.mutex);
+	if (--const_cast<SharedString*>(string)->references == 0) {
+		pool.strings.erase(string->value);
+	}
+}
+
+ItemAttributes::ItemAttributes() { ++liveAttributeLists; }
+
+ItemAttributes::ItemAttributes(const ItemAttributes& other) :
+    attributes(other.attributes), attributeBits(other.attributeBits)
+{
+	if (other.combatModifiers) {
+		combatModifiers.reset(new CombatModifiers(*other.combatModifiers));
+	}
+
+	++liveAttributeLists;
+	liveAttributes += attributes.size();
+	trackCapacity(inlineAttributes);
+}
+
+ItemAttributes::~ItemAttributes()
+{
+	--liveAttributeLists;
+	liveAttributes -= attributes.size();
+	if (attributes.capacity() > inlineAttributes) {
+		--heapAttributeLists;
+		heapAttributeCapacity -= attributes.capacity();
+	}
+}
+
+void ItemAttributes::trackCapacity(size_t oldCapacity)
+{
+	size_t capacity = attributes.capacity();
+	if (capacity == oldCapacity) {
+		return;
+	}
+
+	if (oldCapacity > inlineAttributes) {
+		heapAttributeCapacity -= oldCapacity;
+	} else {
+		++heapAttributeLists;
+	}
+	heapAttributeCapacity += capacity;
+}
+
+ItemAttributes::MemoryUsage ItemAttributes::getMemoryUsage()
+{
+	MemoryUsage usage;
+	usage.instances = liveAttributeLists;
+	usage.attributes = liveAttributes;
+	usage.heapAttributeLists = heapAttributeLists;
+
+	// size of the std::string a legacy attribute allocated for its own copy of a shared string
+	uint64_t legacyStringBytes = 0;
+	{
+		auto& pool = getSharedStringPool();
+		std::lock_guard<std::mutex> lockClass(pool.mutex);
+
+		usage.sharedStrings = pool.strings.size();
+		for (const auto& it : pool.strings) {
+			const SharedString& string = *it.second;
+			usage.sharedStringReferences += string.references;
+
+			// pool node: hash node with key and pointer, the shared string itself and its characters
+			usage.bytes += sizeof(void*) * 2 + sizeof(std::string_view) + sizeof(SharedString);
+			if (string.value.capacity() > std::string().capacity()) {
+				usage.bytes += string.value.capacity() + 1;
+				legacyStringBytes += string.references * (string.value.capacity() + 1);
+			}
+		}
+		usage.bytes += pool.strings.bucket_count() * sizeof(void*);
+	}
+
+	usage.bytes += usage.instances * sizeof(ItemAttributes);
+	usage.bytes += heapAttributeCapacity * sizeof(Attribute);
+
+	usage.legacyBytes = usage.instances * (sizeof(std::vector<Attribute>) + sizeof(uint64_t) +
+	                                       sizeof(std::map<CombatType_t, Reflect>) +
+	                                       sizeof(std::map<CombatType_t, uint16_t>));
+	usage.legacyBytes += usage.attributes * sizeof(Attribute);
+	usage.legacyBytes += usage.sharedStringReferences * sizeof(std::string) + legacyStringBytes;
+	return usage;
+}
+
 std::string_view ItemAttributes::getStrAttr(itemAttrTypes type) const
 {
 	if (!isStrAttrType(type)) {
@@ -1116,7 +1291,7 @@ std::string_view ItemAttributes::getStrAttr(itemAttrTypes type) const
 	if (!attr) {
 		return "";
 	}
-	return {attr->value.string->data(), attr->value.string->size()};
+	return attr->getString();
 }
 
 void ItemAttributes::setStrAttr(itemAttrTypes type, std::string_view value)
@@ -1130,8 +1305,14 @@ void ItemAttributes::setStrAttr(itemAttrTypes type, std::string_view value)
 	}
 
 	Attribute& attr = getAttr(type);
-	delete attr.value.string;
-	attr.value.string = new std::string(value);
+	if (isSharedStrAttrType(type)) {
+		const SharedString* previous = attr.value.shared;
+		attr.value.shared = internString(value);
+		releaseString(previous);
+	} else {
+		delete attr.value.string;
+		attr.value.string = new std::string(value);
+	}
 }
 
 void ItemAttributes::removeAttribute(itemAttrTypes type)
@@ -1154,6 +1335,7 @@ void ItemAttributes::removeAttribute(itemAttrTypes type)
 		}
 	}
 	attributeBits &= ~type;
+	--liveAttributes;
 }
 
 int64_t ItemAttributes::getIntAttr(itemAttrTypes type) const
@@ -1206,8 +1388,11 @@ ItemAttributes::Attribute& ItemAttributes::getAttr(itemAttrTypes type)
 		}
 	}
 
+	size_t oldCapacity = attributes.capacity();
 	attributeBits |= type;
 	attributes.emplace_back(type);
+	++liveAttributes;
+	trackCapacity(oldCapacity);
 	return attributes.back();
 }
 
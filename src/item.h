@@ -106,7 +106,7 @@ enum Attr_ReadValue
 class ItemAttributes
 {
 public:
-	ItemAttributes() = default;
+	ItemAttributes();
 
 	void setSpecialDescription(std::string_view desc) { setStrAttr(ITEM_ATTRIBUTE_DESCRIPTION, desc); }
 	std::string_view getSpecialDescription() const { return getStrAttr(ITEM_ATTRIBUTE_DESCRIPTION); }
@@ -293,12 +293,27 @@ private:
 
 	using CustomAttributeMap = std::unordered_map<std::string, CustomAttribute>;
 
+	// Reference counted string shared by every attribute with the same value, see internString.
+	struct SharedString
+	{
+		std::string value;
+		uint32_t references;
+	};
+
+	struct SharedStringPool;
+	static SharedStringPool& getSharedStringPool();
+
+	static const SharedString* internString(std::string_view value);
+	static const SharedString* retainString(const SharedString* string);
+	static void releaseString(const SharedString* string);
+
 	struct Attribute
 	{
 		union Value
 		{
 			int64_t integer;
 			std::string* string;
+			const SharedString* shared;
 			CustomAttributeMap* custom;
 		};
 
@@ -311,6 +326,8 @@ private:
 			type = i.type;
 			if (ItemAttributes::isIntAttrType(type)) {
 				value.integer = i.value.integer;
+			} else if (ItemAttributes::isSharedStrAttrType(type)) {
+				value.shared = ItemAttributes::retainString(i.value.shared);
 			} else if (ItemAttributes::isStrAttrType(type)) {
 				value.string = new std::string(*i.value.string);
 			} else if (ItemAttributes::isCustomAttrType(type)) {
@@ -324,14 +341,7 @@ private:
 			std::memset(&attribute.value, 0, sizeof(value));
 			attribute.type = ITEM_ATTRIBUTE_NONE;
 		}
-		~Attribute()
-		{
-			if (ItemAttributes::isStrAttrType(type)) {
-				delete value.string;
-			} else if (ItemAttributes::isCustomAttrType(type)) {
-				delete value.custom;
-			}
-		}
+		~Attribute() { reset(); }
 		Attribute& operator=(Attribute other)
 		{
 			Attribute::swap(*this, other);
@@ -340,11 +350,7 @@ private:
 		Attribute& operator=(Attribute&& other)
 		{
 			if (this != &other) {
-				if (ItemAttributes::isStrAttrType(type)) {
-					delete value.string;
-				} else if (ItemAttributes::isCustomAttrType(type)) {
-					delete value.custom;
-				}
+				reset();
 
 				value = other.value;
 				type = other.type;
@@ -355,30 +361,78 @@ private:
 			return *this;
 		}
 
+		std::string_view getString() const
+		{
+			if (ItemAttributes::isSharedStrAttrType(type)) {
+				return value.shared->value;
+			}
+			return *value.string;
+		}
+
 		static void swap(Attribute& first, Attribute& second)
 		{
 			std::swap(first.value, second.value);
 			std::swap(first.type, second.type);
 		}
+
+	private:
+		void reset()
+		{
+			if (ItemAttributes::isSharedStrAttrType(type)) {
+				ItemAttributes::releaseString(value.shared);
+			} else if (ItemAttributes::isStrAttrType(type)) {
+				delete value.string;
+			} else if (ItemAttributes::isCustomAttrType(type)) {
+				delete value.custom;
+			}
+		}
 	};
 
-	std::vector<Attribute> attributes;
+	// Most items carry one or two attributes (decay state and timestamp, an action id, charges), those are stored in
+	// place and only longer lists are moved to the heap.
+	static constexpr size_t inlineAttributes = 2;
+	using AttributeList = boost::container::small_vector<Attribute, inlineAttributes>;
+
+	AttributeList attributes;
 	uint64_t attributeBits = 0;
 
-	std::map<CombatType_t, Reflect> reflect;
-	std::map<CombatType_t, uint16_t> boostPercent;
+	// reflect and boost modifiers are rare, they are only allocated for the items that have them
+	struct CombatModifiers
+	{
+		std::map<CombatType_t, Reflect> reflect;
+		std::map<CombatType_t, uint16_t> boostPercent;
+	};
+	std::unique_ptr<CombatModifiers> combatModifiers;
+
+	CombatModifiers& getCombatModifiers()
+	{
+		if (!combatModifiers) {
+			combatModifiers.reset(new CombatModifiers());
+		}
+		return *combatModifiers;
+	}
 
 	const Reflect& getReflect(CombatType_t combatType)
 	{
-		auto it = reflect.find(combatType);
-		return it != reflect.end() ? it->second : emptyReflect;
+		if (!combatModifiers) {
+			return emptyReflect;
+		}
+
+		auto it = combatModifiers->reflect.find(combatType);
+		return it != combatModifiers->reflect.end() ? it->second : emptyReflect;
 	}
 	int16_t getBoostPercent(CombatType_t combatType)
 	{
-		auto it = boostPercent.find(combatType);
-		return it != boostPercent.end() ? it->second : 0;
+		if (!combatModifiers) {
+			return 0;
+		}
+
+		auto it = combatModifiers->boostPercent.find(combatType);
+		return it != combatModifiers->boostPercent.end() ? it->second : 0;
 	}
 
+	void trackCapacity(size_t oldCapacity);
+
 	std::string_view getStrAttr(itemAttrTypes type) const;
 	void setStrAttr(itemAttrTypes type, std::string_view value);
 
@@ -479,13 +533,37 @@ private:
 	const static uint32_t stringAttributeTypes = ITEM_ATTRIBUTE_DESCRIPTION | ITEM_ATTRIBUTE_TEXT |
 	                                             ITEM_ATTRIBUTE_WRITER | ITEM_ATTRIBUTE_NAME | ITEM_ATTRIBUTE_ARTICLE |
 	                                             ITEM_ATTRIBUTE_PLURALNAME;
+	// string attributes that repeat across many items are interned instead of copied
+	const static uint32_t sharedStringAttributeTypes = ITEM_ATTRIBUTE_DESCRIPTION | ITEM_ATTRIBUTE_WRITER;
 
 public:
+	ItemAttributes(const ItemAttributes& other);
+	~ItemAttributes();
+
+	// non-assignable
+	ItemAttributes& operator=(const ItemAttributes&) = delete;
+
 	static bool isIntAttrType(itemAttrTypes type) { return (type & intAttributeTypes) == type; }
 	static bool isStrAttrType(itemAttrTypes type) { return (type & stringAttributeTypes) == type; }
+	static bool isSharedStrAttrType(itemAttrTypes type) { return (type & sharedStringAttributeTypes) == type; }
 	inline static bool isCustomAttrType(itemAttrTypes type) { return (type & ITEM_ATTRIBUTE_CUSTOM) == type; }
 
-	const std::vector<Attribute>& getList() const { return attributes; }
+	const AttributeList& getList() const { return attributes; }
+
+	struct MemoryUsage
+	{
+		uint64_t instances = 0;
+		uint64_t attributes = 0;
+		uint64_t heapAttributeLists = 0;
+		uint64_t sharedStrings = 0;
+		uint64_t sharedStringReferences = 0;
+
+		// estimated bytes held by attribute storage, with the current layout and with the previous one (a heap
+		// allocated vector of attributes, every string copied per item and the combat modifier maps always present)
+		uint64_t bytes = 0;
+		uint64_t legacyBytes = 0;
+	};
+	static MemoryUsage getMemoryUsage();
 
 	friend class Item;
 };
@@ -499,6 +577,15 @@ public:
 	static Item* CreateItem(PropStream& propStream);
 	static Items items;
 
+	// Unique ids and bed sleepers read from the map, collected here instead of registered with the game while the map
+	// loader decodes tile areas on its threads; the loader registers them on the loading thread.
+	struct MapLoadRegistrations
+	{
+		std::vector<std::pair<Item*, uint16_t>> uniqueIds;
+		std::vector<std::pair<BedItem*, uint32_t>> bedSleepers;
+	};
+	static thread_local MapLoadRegistrations* mapLoadRegistrations;
+
 	// Constructor for items
 	Item(const uint16_t type, uint16_t count = 0);
 	Item(const Item& i);
@@ -506,6 +593,10 @@ public:
 
 	virtual ~Item() = default;
 
+	// allocated from a slab, see slab.h
+	static void* operator new(size_t size);
+	static void operator delete(void* p, size_t size);
+
 	// non-assignable
 	Item& operator=(const Item&) = delete;
 
@@ -809,19 +900,25 @@ public:
 	uint32_t getWorth() const;
 	LightInfo getLightInfo() const;
 
-	void setReflect(CombatType_t combatType, const Reflect& reflect) { getAttributes()->reflect[combatType] = reflect; }
+	void setReflect(CombatType_t combatType, const Reflect& reflect)
+	{
+		getAttributes()->getCombatModifiers().reflect[combatType] = reflect;
+	}
 	Reflect getReflect(CombatType_t combatType, bool total = true) const;
 
-	void setBoostPercent(CombatType_t combatType, uint16_t value) { getAttributes()->boostPercent[combatType] = value; }
+	void setBoostPercent(CombatType_t combatType, uint16_t value)
+	{
+		getAttributes()->getCombatModifiers().boostPercent[combatType] = value;
+	}
 	uint16_t getBoostPercent(CombatType_t combatType, bool total = true) const;
 
 	bool hasProperty(ITEMPROPERTY prop) const;
-	bool isBlocking() const { return items[id].blockSolid; }
-	bool isStackable() const { return items[id].stackable; }
-	bool isAlwaysOnTop() const { return items[id].alwaysOnTop; }
+	bool isBlocking() const { return items.hasPropertyFlag(id, ITEMTYPE_FLAG_BLOCKSOLID); }
+	bool isStackable() const { return items.hasPropertyFlag(id, ITEMTYPE_FLAG_STACKABLE); }
+	bool isAlwaysOnTop() const { return items.hasPropertyFlag(id, ITEMTYPE_FLAG_ALWAYSONTOP); }
 	bool isGroundTile() const { return items[id].isGroundTile(); }
-	bool isMagicField() const { return items[id].isMagicField(); }
-	bool isMoveable() const { return items[id].moveable; }
+	bool isMagicField() const { return items.hasPropertyFlag(id, ITEMTYPE_FLAG_MAGICFIELD); }
+	bool isMoveable() const { return items.hasPropertyFlag(id, ITEMTYPE_FLAG_MOVEABLE); }
 	bool isPickupable() const { return items[id].isPickupable(); }
 	bool isUseable() const { return items[id].useable; }
 	bool isHangable() const { return items[id].isHangable; }
@@ -17,7 +17,7 @@ extern Scripts* g_scripts;
 
 namespace {
 
-const std::unordered_map<std::string, ItemParseAttributes_t> ItemParseAttributesMap = {
+constexpr std::pair<std::string_view, ItemParseAttributes_t> ItemParseAttributes[] = {
     {"type", ITEM_PARSE_TYPE},
     {"description", ITEM_PARSE_DESCRIPTION},
     {"runespellname", ITEM_PARSE_RUNESPELLNAME},
@@ -214,6 +214,55 @@ const std::unordered_map<std::string, ItemParseAttributes_t> ItemParseAttributes
     {"reduceskillloss", ITEM_PARSE_REDUCESKILLLOSS},
 };
 
+constexpr char toLowerAscii(char ch) { return ch >= 'A' && ch <= 'Z' ? ch - 'A' + 'a' : ch; }
+
+constexpr uint32_t hashAttributeKey(std::string_view key)
+{
+	uint32_t hash = 2166136261;
+	for (char ch : key) {
+		hash = (hash ^ static_cast<uint8_t>(toLowerAscii(ch))) * 16777619;
+	}
+	return hash;
+}
+
+// Every <attribute> of every item is looked up here. The open addressing table is laid out at compile time and
+// probed with a case-insensitive hash, so the key is neither copied nor lowered first.
+class ItemParseAttributesTable
+{
+	static constexpr size_t slotCount = 1024;
+	static_assert(std::size(ItemParseAttributes) < slotCount / 2);
+
+public:
+	constexpr ItemParseAttributesTable()
+	{
+		for (size_t i = 0; i < std::size(ItemParseAttributes); ++i) {
+			size_t slot = hashAttributeKey(ItemParseAttributes[i].first) & (slotCount - 1);
+			while (slots[slot] != 0) {
+				slot = (slot + 1) & (slotCount - 1);
+			}
+			slots[slot] = static_cast<uint16_t>(i + 1);
+		}
+	}
+
+	const ItemParseAttributes_t* find(std::string_view key) const
+	{
+		for (size_t slot = hashAttributeKey(key) & (slotCount - 1); slots[slot] != 0;
+		     slot = (slot + 1) & (slotCount - 1)) {
+			const auto& entry = ItemParseAttributes[slots[slot] - 1];
+			if (caseInsensitiveEqual(entry.first, key)) {
+				return &entry.second;
+			}
+		}
+		return nullptr;
+	}
+
+private:
+	// index + 1 into ItemParseAttributes, 0 marks an empty slot
+	std::array<uint16_t, slotCount> slots{};
+};
+
+constexpr ItemParseAttributesTable ItemParseAttributesMap;
+
 const std::unordered_map<std::string, ItemTypes_t> ItemTypesMap = {{"key", ITEM_TYPE_KEY},
                                                                    {"magicfield", ITEM_TYPE_MAGICFIELD},
                                                                    {"container", ITEM_TYPE_CONTAINER},
@@ -321,6 +370,7 @@ Items::Items()
 void Items::clear()
 {
 	items.clear();
+	propertyFlags.clear();
 	clientIdToServerIdMap.clear();
 	nameToItems.clear();
 	currencyItems.clear();
@@ -329,6 +379,13 @@ void Items::clear()
 
 bool Items::reload()
 {
+	// registries that are not reloaded below keep their flags
+	std::vector<uint8_t> scriptEvents;
+	scriptEvents.reserve(items.size());
+	for (const ItemType& it : items) {
+		scriptEvents.push_back(it.scriptEvents);
+	}
+
 	clear();
 	loadFromOtb("data/items/items.otb");
 
@@ -336,6 +393,10 @@ bool Items::reload()
 		return false;
 	}
 
+	for (size_t id = 0, size = std::min(items.size(), scriptEvents.size()); id < size; ++id) {
+		items[id].scriptEvents = scriptEvents[id];
+	}
+
 	g_scripts->loadScripts("items", false, true);
 	g_moveEvents->reload();
 	g_weapons->reload();
@@ -578,6 +639,7 @@ bool Items::loadFromOtb(const std::string& file)
 	}
 
 	items.shrink_to_fit();
+	buildPropertyFlags();
 	return true;
 }
 
@@ -590,10 +652,21 @@ bool Items::loadFromXml()
 		return false;
 	}
 
+	// item nodes in document order, fromid/toid ranges expanded
+	struct ItemNode
+	{
+		pugi::xml_node node;
+		uint16_t id;
+		bool parsed = false;
+		// items this one transforms to on use, they get it as transformToFree in the serial pass
+		std::vector<uint16_t> transformTargets = {};
+	};
+	std::vector<ItemNode> itemNodes;
+
 	for (auto itemNode : doc.child("items").children()) {
 		pugi::xml_attribute idAttribute = itemNode.attribute("id");
 		if (idAttribute) {
-			parseItemNode(itemNode, pugi::cast<uint16_t>(idAttribute.value()));
+			itemNodes.push_back({itemNode, pugi::cast<uint16_t>(idAttribute.value())});
 			continue;
 		}
 
@@ -613,13 +686,90 @@ bool Items::loadFromXml()
 		uint16_t id = pugi::cast<uint16_t>(fromIdAttribute.value());
 		uint16_t toId = pugi::cast<uint16_t>(toIdAttribute.value());
 		while (id <= toId) {
-			parseItemNode(itemNode, id++);
+			itemNodes.push_back({itemNode, id++});
+		}
+	}
+
+	// every thread owns a contiguous range of item ids, so each ItemType is only ever written by one of them and
+	// nodes for the same id are still applied in document order
+	size_t threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+	size_t idsPerThread = items.size() / threads + 1;
+
+	std::vector<std::thread> workers;
+	for (size_t thread = 0; thread < threads; ++thread) {
+		workers.emplace_back([&, firstId = thread * idsPerThread, lastThread = thread + 1 == threads]() {
+			for (auto& itemNode : itemNodes) {
+				if (itemNode.id >= firstId && (lastThread || itemNode.id < firstId + idsPerThread)) {
+					itemNode.parsed = parseItemNode(itemNode.node, itemNode.id, itemNode.transformTargets);
+				}
+			}
+		});
+	}
+	for (auto& worker : workers) {
+		worker.join();
+	}
+
+	// the lookups shared by all items and the links into other threads' id ranges are filled in document order, first
+	// name, first worth and first transform win
+	for (const auto& itemNode : itemNodes) {
+		if (itemNode.parsed) {
+			indexItemType(items[itemNode.id], itemNode.transformTargets);
 		}
 	}
+
+	buildPropertyFlags();
 	return true;
 }
 
-void Items::parseItemNode(const pugi::xml_node& itemNode, uint16_t id)
+void Items::indexItemType(ItemType& it, const std::vector<uint16_t>& transformTargets)
+{
+	// an item's own transformTo was parsed already and takes precedence
+	for (uint16_t target : transformTargets) {
+		ItemType& other = getItemType(target);
+		if (other.transformToFree == 0) {
+			other.transformToFree = it.id;
+		}
+	}
+
+	if (!it.name.empty()) {
+		std::string lowerCaseName = boost::algorithm::to_lower_copy(it.name);
+		if (nameToItems.find(lowerCaseName) == nameToItems.end()) {
+			nameToItems.emplace(std::move(lowerCaseName), it.id);
+		}
+	}
+
+	if (it.worth != 0) {
+		if (currencyItems.find(it.worth) != currencyItems.end()) {
+			std::cout << "[Warning - Items::loadFromXml] Duplicated currency worth. Item " << it.id
+			          << " redefines worth " << it.worth << std::endl;
+			it.worth = 0;
+		} else {
+			currencyItems.insert(CurrencyMap::value_type(it.worth, it.id));
+		}
+	}
+}
+
+void Items::buildPropertyFlags()
+{
+	propertyFlags.assign(items.size(), 0);
+	for (size_t id = 0, size = items.size(); id < size; ++id) {
+		const ItemType& it = items[id];
+		uint16_t flags = 0;
+		flags |= it.blockSolid ? ITEMTYPE_FLAG_BLOCKSOLID : 0;
+		flags |= it.hasHeight ? ITEMTYPE_FLAG_HASHEIGHT : 0;
+		flags |= it.blockProjectile ? ITEMTYPE_FLAG_BLOCKPROJECTILE : 0;
+		flags |= it.blockPathFind ? ITEMTYPE_FLAG_BLOCKPATHFIND : 0;
+		flags |= it.isVertical ? ITEMTYPE_FLAG_VERTICAL : 0;
+		flags |= it.isHorizontal ? ITEMTYPE_FLAG_HORIZONTAL : 0;
+		flags |= it.moveable ? ITEMTYPE_FLAG_MOVEABLE : 0;
+		flags |= it.isMagicField() ? ITEMTYPE_FLAG_MAGICFIELD : 0;
+		flags |= it.stackable ? ITEMTYPE_FLAG_STACKABLE : 0;
+		flags |= it.alwaysOnTop ? ITEMTYPE_FLAG_ALWAYSONTOP : 0;
+		propertyFlags[id] = flags;
+	}
+}
+
+bool Items::parseItemNode(const pugi::xml_node& itemNode, uint16_t id, std::vector<uint16_t>& transformTargets)
 {
 	if (id > 0 && id < 100) {
 		ItemType& iType = items[id];
@@ -628,23 +778,16 @@ void Items::parseItemNode(const pugi::xml_node& itemNode, uint16_t id)
 
 	ItemType& it = getItemType(id);
 	if (it.id == 0) {
-		return;
+		return false;
 	}
 
 	if (!it.name.empty()) {
 		std::cout << "[Warning - Items::parseItemNode] Duplicate item with id: " << id << std::endl;
-		return;
+		return false;
 	}
 
 	it.name = itemNode.attribute("name").as_string();
 
-	if (!it.name.empty()) {
-		std::string lowerCaseName = boost::algorithm::to_lower_copy(it.name);
-		if (nameToItems.find(lowerCaseName) == nameToItems.end()) {
-			nameToItems.emplace(std::move(lowerCaseName), id);
-		}
-	}
-
 	pugi::xml_attribute articleAttribute = itemNode.attribute("article");
 	if (articleAttribute) {
 		it.article = articleAttribute.as_string();
@@ -677,10 +820,9 @@ void Items::parseItemNode(const pugi::xml_node& itemNode, uint16_t id)
 			}
 		}
 
-		std::string tmpStrValue = boost::algorithm::to_lower_copy<std::string>(keyAttribute.as_string());
-		auto parseAttribute = ItemParseAttributesMap.find(tmpStrValue);
-		if (parseAttribute != ItemParseAttributesMap.end()) {
-			ItemParseAttributes_t parseType = parseAttribute->second;
+		if (const ItemParseAttributes_t* parseAttribute = ItemParseAttributesMap.find(keyAttribute.as_string())) {
+			ItemParseAttributes_t parseType = *parseAttribute;
+			std::string tmpStrValue;
 			switch (parseType) {
 				case ITEM_PARSE_TYPE: {
 					tmpStrValue = boost::algorithm::to_lower_copy<std::string>(valueAttribute.as_string());
@@ -1789,10 +1931,7 @@ void Items::parseItemNode(const pugi::xml_node& itemNode, uint16_t id)
 				case ITEM_PARSE_MALETRANSFORMTO: {
 					uint16_t value = pugi::cast<uint16_t>(valueAttribute.value());
 					it.transformToOnUse[PLAYERSEX_MALE] = value;
-					ItemType& other = getItemType(value);
-					if (other.transformToFree == 0) {
-						other.transformToFree = it.id;
-					}
+					transformTargets.push_back(value);
 
 					if (it.transformToOnUse[PLAYERSEX_FEMALE] == 0) {
 						it.transformToOnUse[PLAYERSEX_FEMALE] = value;
@@ -1803,11 +1942,7 @@ void Items::parseItemNode(const pugi::xml_node& itemNode, uint16_t id)
 				case ITEM_PARSE_FEMALETRANSFORMTO: {
 					uint16_t value = pugi::cast<uint16_t>(valueAttribute.value());
 					it.transformToOnUse[PLAYERSEX_FEMALE] = value;
-
-					ItemType& other = getItemType(value);
-					if (other.transformToFree == 0) {
-						other.transformToFree = it.id;
-					}
+					transformTargets.push_back(value);
 
 					if (it.transformToOnUse[PLAYERSEX_MALE] == 0) {
 						it.transformToOnUse[PLAYERSEX_MALE] = value;
@@ -1882,14 +2017,8 @@ void Items::parseItemNode(const pugi::xml_node& itemNode, uint16_t id)
 				}
 
 				case ITEM_PARSE_WORTH: {
-					uint64_t worth = pugi::cast<uint64_t>(valueAttribute.value());
-					if (currencyItems.find(worth) != currencyItems.end()) {
-						std::cout << "[Warning - Items::parseItemNode] Duplicated currency worth. Item " << id
-						          << " redefines worth " << worth << std::endl;
-					} else {
-						currencyItems.insert(CurrencyMap::value_type(worth, id));
-						it.worth = worth;
-					}
+					// registered in currencyItems by indexItemType
+					it.worth = pugi::cast<uint64_t>(valueAttribute.value());
 					break;
 				}
 
@@ -1948,6 +2077,7 @@ void Items::parseItemNode(const pugi::xml_node& itemNode, uint16_t id)
 	    it.type != ITEM_TYPE_BED) {
 		std::cout << "[Warning - Items::parseItemNode] Item " << it.id << " is not set as a bed-type" << std::endl;
 	}
+	return true;
 }
 
 void Items::buildInventoryList()
@@ -1981,6 +2111,20 @@ const ItemType& Items::getItemType(size_t id) const
 	return items.front();
 }
 
+void Items::setScriptEvent(uint16_t id, ItemScriptEvents_t event)
+{
+	if (id < items.size()) {
+		items[id].scriptEvents |= event;
+	}
+}
+
+void Items::resetScriptEvents(ItemScriptEvents_t event)
+{
+	for (ItemType& it : items) {
+		it.scriptEvents &= ~event;
+	}
+}
+
 const ItemType& Items::getItemIdByClientId(uint16_t spriteId) const
 {
 	if (spriteId >= 100) {
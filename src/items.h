@@ -45,6 +45,32 @@ enum ItemTypes_t
 	ITEM_TYPE_LAST
 };
 
+// set on an ItemType by the script registries that handle its id, so hot paths can skip lookups for the (common)
+// items without any script
+enum ItemScriptEvents_t : uint8_t
+{
+	ITEM_SCRIPT_ACTION = 1 << 0,
+	ITEM_SCRIPT_RUNE = 1 << 1,
+	ITEM_SCRIPT_MOVEEVENT = 1 << 2,
+	ITEM_SCRIPT_WEAPON = 1 << 3,
+};
+
+// copy of the ItemType flags read by Tile and Item hot paths, kept in a dense per id array (Items::propertyFlags) so
+// scanning a tile does not pull in a whole ItemType for each item
+enum ItemTypeFlags_t : uint16_t
+{
+	ITEMTYPE_FLAG_BLOCKSOLID = 1 << 0,
+	ITEMTYPE_FLAG_HASHEIGHT = 1 << 1,
+	ITEMTYPE_FLAG_BLOCKPROJECTILE = 1 << 2,
+	ITEMTYPE_FLAG_BLOCKPATHFIND = 1 << 3,
+	ITEMTYPE_FLAG_VERTICAL = 1 << 4,
+	ITEMTYPE_FLAG_HORIZONTAL = 1 << 5,
+	ITEMTYPE_FLAG_MOVEABLE = 1 << 6,
+	ITEMTYPE_FLAG_MAGICFIELD = 1 << 7,
+	ITEMTYPE_FLAG_STACKABLE = 1 << 8,
+	ITEMTYPE_FLAG_ALWAYSONTOP = 1 << 9,
+};
+
 enum ItemParseAttributes_t
 {
 	ITEM_PARSE_TYPE,
@@ -309,6 +335,7 @@ public:
 	bool isUseable() const { return (useable); }
 	bool hasSubType() const { return (isFluidContainer() || isSplash() || stackable || charges != 0); }
 	bool isSupply() const { return supply; }
+	bool hasScriptEvent(ItemScriptEvents_t event) const { return (scriptEvents & event) != 0; }
 
 	Abilities& getAbilities()
 	{
@@ -388,6 +415,7 @@ public:
 	uint8_t lightColor = 0;
 	uint8_t shootRange = 1;
 	int8_t hitChance = 0;
+	uint8_t scriptEvents = 0;
 
 	bool storeItem = false;
 	bool forceUse = false;
@@ -456,7 +484,15 @@ public:
 	uint32_t buildNumber = 0;
 
 	bool loadFromXml();
-	void parseItemNode(const pugi::xml_node& itemNode, uint16_t id);
+	// returns false if the node was skipped (unknown or duplicate id); the items it transforms to on use are added to
+	// transformTargets instead of being written, they may belong to another thread
+	bool parseItemNode(const pugi::xml_node& itemNode, uint16_t id, std::vector<uint16_t>& transformTargets);
+
+	uint16_t getPropertyFlags(size_t id) const { return id < propertyFlags.size() ? propertyFlags[id] : 0; }
+	bool hasPropertyFlag(size_t id, ItemTypeFlags_t flag) const { return (getPropertyFlags(id) & flag) != 0; }
+
+	void setScriptEvent(uint16_t id, ItemScriptEvents_t event);
+	void resetScriptEvents(ItemScriptEvents_t event);
 
 	void buildInventoryList();
 	const InventoryVector& getInventory() const { return inventory; }
@@ -467,7 +503,11 @@ public:
 	CurrencyMap currencyItems;
 
 private:
+	void indexItemType(ItemType& it, const std::vector<uint16_t>& transformTargets);
+	void buildPropertyFlags();
+
 	std::vector<ItemType> items;
+	std::vector<uint16_t> propertyFlags;
 	InventoryVector inventory;
 	class ClientIdToServerIdMap
 	{
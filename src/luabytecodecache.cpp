@@ -0,0 +1,159 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#include "otpch.h"
+
+#include "luabytecodecache.h"
+
+#include "configmanager.h"
+#include "tools.h"
+
+#include <fstream>
+
+namespace {
+
+const std::filesystem::path cacheDirectory = "data/cache/lua";
+
+#if defined(LUAJIT_VERSION)
+constexpr std::string_view luaVersion = LUAJIT_VERSION;
+#else
+constexpr std::string_view luaVersion = LUA_RELEASE;
+#endif
+
+struct CachedChunk
+{
+	std::filesystem::file_time_type modified;
+	uintmax_t size = 0;
+	uint64_t key = 0;
+	std::string bytecode;
+};
+
+std::unordered_map<std::string, CachedChunk> chunks;
+
+std::filesystem::path getCachePath(uint64_t key) { return cacheDirectory / fmt::format("{:016x}.luac", key); }
+
+bool readFile(const std::filesystem::path& path, std::string& contents)
+{
+	std::ifstream file{path, std::ios::binary};
+	if (!file) {
+		return false;
+	}
+
+	contents.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+	return !file.bad();
+}
+
+void writeCachedBytecode(uint64_t key, const std::string& bytecode)
+{
+	std::error_code ec;
+	std::filesystem::create_directories(cacheDirectory, ec);
+
+	// written aside and renamed, a crash while writing never leaves a truncated chunk behind
+	const auto path = getCachePath(key);
+	auto tmpPath = path;
+	tmpPath += ".tmp";
+	{
+		std::ofstream file{tmpPath, std::ios::binary | std::ios::trunc};
+		file.write(bytecode.data(), bytecode.size());
+		if (!file) {
+			return;
+		}
+	}
+
+	std::filesystem::rename(tmpPath, path, ec);
+}
+
+int writeChunk(lua_State*, const void* data, size_t size, void* userdata)
+{
+	static_cast<std::string*>(userdata)->append(static_cast<const char*>(data), size);
+	return 0;
+}
+
+// luaL_loadfile skips a UTF-8 byte order mark and a first line starting with '#', the newline is kept so the line
+// numbers stay the same
+std::string_view skipPrefix(std::string_view source)
+{
+	if (source.starts_with("\xEF\xBB\xBF")) {
+		source.remove_prefix(3);
+	}
+
+	if (source.starts_with('#')) {
+		source.remove_prefix(std::min(source.find('\n'), source.size()));
+	}
+	return source;
+}
+
+// compiles the source and keeps the chunk on the stack, or the error message as luaL_loadbufferx does
+int compile(lua_State* L, std::string_view source, const std::string& chunkName, CachedChunk& chunk)
+{
+	int ret = luaL_loadbufferx(L, source.data(), source.size(), chunkName.c_str(), nullptr);
+	if (ret != LUA_OK) {
+		return ret;
+	}
+
+	chunk.bytecode.clear();
+#if defined(LUAJIT_VERSION)
+	lua_dump(L, writeChunk, &chunk.bytecode);
+#else
+	lua_dump(L, writeChunk, &chunk.bytecode, 0);
+#endif
+	writeCachedBytecode(chunk.key, chunk.bytecode);
+	return LUA_OK;
+}
+
+} // namespace
+
+int LuaBytecodeCache::loadFile(lua_State* L, const std::string& fileName)
+{
+	if (!getBoolean(ConfigManager::LUA_BYTECODE_CACHE)) {
+		return luaL_loadfile(L, fileName.c_str());
+	}
+
+	std::error_code ec;
+	auto modified = std::filesystem::last_write_time(fileName, ec);
+	uintmax_t size = ec ? 0 : std::filesystem::file_size(fileName, ec);
+	if (ec) {
+		// a missing file is reported by Lua, with the message scripts always got
+		return luaL_loadfile(L, fileName.c_str());
+	}
+
+	const std::string chunkName = "@" + fileName;
+	auto it = chunks.find(fileName);
+	if (it == chunks.end() || it->second.modified != modified || it->second.size != size) {
+		std::string source;
+		if (!readFile(fileName, source)) {
+			return luaL_loadfile(L, fileName.c_str());
+		}
+
+		// a file touched without changes keeps its chunk
+		std::string_view code = skipPrefix(source);
+		std::string keyData = fmt::format("{:s}\n{:s}\n", luaVersion, fileName);
+		keyData.append(code);
+		uint64_t key = fnv1a(keyData.data(), keyData.size());
+
+		CachedChunk& chunk = chunks[fileName];
+		chunk.modified = modified;
+		chunk.size = size;
+		if (chunk.key != key || chunk.bytecode.empty()) {
+			chunk.key = key;
+			if (!readFile(getCachePath(key), chunk.bytecode) || chunk.bytecode.empty()) {
+				int ret = compile(L, code, chunkName, chunk);
+				if (ret != LUA_OK) {
+					chunks.erase(fileName);
+				}
+				return ret;
+			}
+		}
+		it = chunks.find(fileName);
+	}
+
+	const CachedChunk& chunk = it->second;
+	if (luaL_loadbufferx(L, chunk.bytecode.data(), chunk.bytecode.size(), chunkName.c_str(), "b") != LUA_OK) {
+		// written by another build of Lua or damaged, compile the source again
+		lua_pop(L, 1);
+		std::filesystem::remove(getCachePath(chunk.key), ec);
+		chunks.erase(it);
+		return luaL_loadfile(L, fileName.c_str());
+	}
+	return LUA_OK;
+}
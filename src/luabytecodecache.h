@@ -0,0 +1,20 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#ifndef FS_LUABYTECODECACHE_H
+#define FS_LUABYTECODECACHE_H
+
+// Compiled script files, kept in memory and in data/cache/lua keyed by a hash of the file name, its contents and the
+// Lua version. Loading a file whose compiled chunk is cached skips the parser, so an NPC script shared by many NPCs is
+// compiled once, and a restart or reload only compiles the files that changed.
+//
+// Files are checked by their size and modification time first, their contents are only read and hashed when those
+// changed. The disk cache is trusted like the scripts themselves: whoever can write it can run code on the server.
+namespace LuaBytecodeCache {
+
+// same contract as luaL_loadfile: pushes the chunk and returns LUA_OK, or pushes an error message
+int loadFile(lua_State* L, const std::string& fileName);
+
+} // namespace LuaBytecodeCache
+
+#endif // FS_LUABYTECODECACHE_H
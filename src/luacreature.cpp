@@ -36,8 +36,7 @@ int luaCreatureCreate(lua_State* L)
 	}
 
 	if (creature) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -263,8 +262,7 @@ int luaCreatureGetTarget(lua_State* L)
 
 	Creature* target = creature->getAttackedCreature();
 	if (target) {
-		pushUserdata<Creature>(L, target);
-		setCreatureMetatable(L, -1, target);
+		pushCreature(L, target);
 	} else {
 		lua_pushnil(L);
 	}
@@ -294,8 +292,7 @@ int luaCreatureGetFollowCreature(lua_State* L)
 
 	Creature* followCreature = creature->getFollowCreature();
 	if (followCreature) {
-		pushUserdata<Creature>(L, followCreature);
-		setCreatureMetatable(L, -1, followCreature);
+		pushCreature(L, followCreature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -329,8 +326,7 @@ int luaCreatureGetMaster(lua_State* L)
 		return 1;
 	}
 
-	pushUserdata<Creature>(L, master);
-	setCreatureMetatable(L, -1, master);
+	pushCreature(L, master);
 	return 1;
 }
 
@@ -870,7 +866,7 @@ int luaCreatureSay(lua_State* L)
 
 	// Prevent infinity echo on event onHear
 	bool echo =
-	    LuaScriptInterface::getScriptEnv()->getScriptId() == g_events->getScriptId(EventInfoId::CREATURE_ONHEAR);
+	    LuaScriptInterface::getScriptEnv()->getScriptId() == g_events->getScriptId(EventHook::CREATURE_ONHEAR);
 
 	if (position.x != 0) {
 		pushBoolean(L, g_game.internalCreatureSay(creature, type, text, ghost, &spectators, &position, echo));
@@ -913,8 +909,7 @@ int luaCreatureGetSummons(lua_State* L)
 
 	int index = 0;
 	for (Creature* summon : creature->getSummons()) {
-		pushUserdata<Creature>(L, summon);
-		setCreatureMetatable(L, -1, summon);
+		pushCreature(L, summon);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -6,15 +6,20 @@
 #include "configmanager.h"
 #include "events.h"
 #include "game.h"
+#include "globalevent.h"
+#include "item.h"
 #include "luascript.h"
 #include "monster.h"
 #include "monsters.h"
 #include "script.h"
+#include "scriptprofiler.h"
+#include "slab.h"
 #include "talkaction.h"
 
 extern Events* g_events;
 extern Vocations g_vocations;
 extern Game g_game;
+extern GlobalEvents* g_globalEvents;
 extern Monsters g_monsters;
 extern Scripts* g_scripts;
 extern TalkActions* g_talkActions;
@@ -44,8 +49,7 @@ int luaGameGetSpectators(lua_State* L)
 
 	int index = 0;
 	for (Creature* creature : spectators) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -58,8 +62,7 @@ int luaGameGetPlayers(lua_State* L)
 
 	int index = 0;
 	for (const auto& playerEntry : g_game.getPlayers()) {
-		pushUserdata<Player>(L, playerEntry.second);
-		setMetatable(L, -1, "Player");
+		pushCreature(L, playerEntry.second);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -419,8 +422,7 @@ int luaGameCreateMonster(lua_State* L)
 	MagicEffectClasses magicEffect = getInteger<MagicEffectClasses>(L, 5, CONST_ME_TELEPORT);
 	if (g_events->eventMonsterOnSpawn(monster, position, false, true) || force) {
 		if (g_game.placeCreature(monster, position, extended, force, magicEffect)) {
-			pushUserdata<Monster>(L, monster);
-			setMetatable(L, -1, "Monster");
+			pushCreature(L, monster);
 		} else {
 			delete monster;
 			lua_pushnil(L);
@@ -446,8 +448,7 @@ int luaGameCreateNpc(lua_State* L)
 	bool force = getBoolean(L, 4, false);
 	MagicEffectClasses magicEffect = getInteger<MagicEffectClasses>(L, 5, CONST_ME_TELEPORT);
 	if (g_game.placeCreature(npc, position, extended, force, magicEffect)) {
-		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		pushCreature(L, npc);
 	} else {
 		delete npc;
 		lua_pushnil(L);
@@ -605,6 +606,142 @@ int luaGameReload(lua_State* L)
 	return 1;
 }
 
+int luaGameGetMemoryUsage(lua_State* L)
+{
+	// Game.getMemoryUsage()
+	lua_createtable(L, 0, 2);
+
+	const auto itemAttributes = ItemAttributes::getMemoryUsage();
+	lua_createtable(L, 0, 7);
+	setField(L, "instances", itemAttributes.instances);
+	setField(L, "attributes", itemAttributes.attributes);
+	setField(L, "heapAttributeLists", itemAttributes.heapAttributeLists);
+	setField(L, "sharedStrings", itemAttributes.sharedStrings);
+	setField(L, "sharedStringReferences", itemAttributes.sharedStringReferences);
+	setField(L, "bytes", itemAttributes.bytes);
+	setField(L, "legacyBytes", itemAttributes.legacyBytes);
+	lua_setfield(L, -2, "itemAttributes");
+
+	const auto slabs = SlabAllocator::getAllStats();
+	lua_createtable(L, slabs.size(), 0);
+
+	int index = 0;
+	for (const auto& slab : slabs) {
+		lua_createtable(L, 0, 5);
+		setField(L, "name", slab.name);
+		setField(L, "objectSize", slab.objectSize);
+		setField(L, "live", slab.live);
+		setField(L, "peak", slab.peak);
+		setField(L, "capacity", slab.capacity);
+		lua_rawseti(L, -2, ++index);
+	}
+	lua_setfield(L, -2, "slabs");
+	return 1;
+}
+
+int luaGameGetLuaMemoryUsage(lua_State* L)
+{
+	// Game.getLuaMemoryUsage([limit = 10])
+	const auto limit = getInteger<size_t>(L, 1, 10);
+
+	std::vector<std::pair<std::string_view, LuaAllocationStats>> scripts;
+	for (const auto& [name, stats] : g_luaEnvironment.getAllocationStats()) {
+		scripts.emplace_back(name, stats);
+	}
+
+	const size_t count = std::min(limit, scripts.size());
+	std::partial_sort(scripts.begin(), scripts.begin() + count, scripts.end(),
+	                  [](const auto& lhs, const auto& rhs) { return lhs.second.bytes > rhs.second.bytes; });
+
+	lua_createtable(L, 0, 3);
+	setField(L, "usedBytes", int64_t{lua_gc(L, LUA_GCCOUNT, 0)} * 1024 + lua_gc(L, LUA_GCCOUNTB, 0));
+	setField(L, "allocatedBytes", g_luaEnvironment.getAllocatedBytes());
+
+	lua_createtable(L, count, 0);
+	for (size_t i = 0; i < count; ++i) {
+		lua_createtable(L, 0, 3);
+		setField(L, "name", scripts[i].first);
+		setField(L, "bytes", scripts[i].second.bytes);
+		setField(L, "allocations", scripts[i].second.allocations);
+		lua_rawseti(L, -2, i + 1);
+	}
+	lua_setfield(L, -2, "scripts");
+	return 1;
+}
+
+int luaGameResetLuaMemoryUsage(lua_State* L)
+{
+	// Game.resetLuaMemoryUsage()
+	g_luaEnvironment.resetAllocationStats();
+	pushBoolean(L, true);
+	return 1;
+}
+
+int luaGameStartScriptProfiler(lua_State* L)
+{
+	// Game.startScriptProfiler()
+	g_scriptProfiler.start();
+	pushBoolean(L, true);
+	return 1;
+}
+
+int luaGameStopScriptProfiler(lua_State* L)
+{
+	// Game.stopScriptProfiler()
+	if (!g_scriptProfiler.isRunning()) {
+		lua_pushnil(L);
+		return 1;
+	}
+
+	const std::string fileName = g_scriptProfiler.stop();
+	if (fileName.empty()) {
+		lua_pushnil(L);
+	} else {
+		pushString(L, fileName);
+	}
+	return 1;
+}
+
+int luaGameGetGlobalEventStats(lua_State* L)
+{
+	// Game.getGlobalEventStats([limit = 10])
+	const auto limit = getInteger<size_t>(L, 1, 10);
+
+	std::vector<const GlobalEvent*> globalEvents;
+	g_globalEvents->forEachEvent([&](const GlobalEvent& globalEvent) {
+		if (globalEvent.getStats().executions != 0) {
+			globalEvents.push_back(&globalEvent);
+		}
+	});
+
+	const size_t count = std::min(limit, globalEvents.size());
+	std::partial_sort(globalEvents.begin(), globalEvents.begin() + count, globalEvents.end(),
+	                  [](const GlobalEvent* lhs, const GlobalEvent* rhs) {
+		                  return lhs->getStats().totalTime > rhs->getStats().totalTime;
+	                  });
+
+	using Milliseconds = std::chrono::duration<double, std::milli>;
+	lua_createtable(L, count, 0);
+	for (size_t i = 0; i < count; ++i) {
+		const GlobalEventStats& stats = globalEvents[i]->getStats();
+		lua_createtable(L, 0, 4);
+		setField(L, "name", globalEvents[i]->getName());
+		setField(L, "executions", stats.executions);
+		setField(L, "totalTime", std::chrono::duration_cast<Milliseconds>(stats.totalTime).count());
+		setField(L, "maxTime", std::chrono::duration_cast<Milliseconds>(stats.maxTime).count());
+		lua_rawseti(L, -2, i + 1);
+	}
+	return 1;
+}
+
+int luaGameSetEventCallbackCount(lua_State* L)
+{
+	// Game.setEventCallbackCount(methodName, count)
+	g_events->setCallbackCount(getString(L, 1), getNumber<uint32_t>(L, 2));
+	pushBoolean(L, true);
+	return 1;
+}
+
 int luaGameGetAccountStorageValue(lua_State* L)
 {
 	// Game.getAccountStorageValue(accountId, key)
@@ -755,6 +892,15 @@ void LuaScriptInterface::registerGame()
 	registerMethod("Game", "getClientVersion", luaGameGetClientVersion);
 
 	registerMethod("Game", "reload", luaGameReload);
+	registerMethod("Game", "getMemoryUsage", luaGameGetMemoryUsage);
+	registerMethod("Game", "getLuaMemoryUsage", luaGameGetLuaMemoryUsage);
+	registerMethod("Game", "resetLuaMemoryUsage", luaGameResetLuaMemoryUsage);
+
+	registerMethod("Game", "startScriptProfiler", luaGameStartScriptProfiler);
+	registerMethod("Game", "stopScriptProfiler", luaGameStopScriptProfiler);
+
+	registerMethod("Game", "getGlobalEventStats", luaGameGetGlobalEventStats);
+	registerMethod("Game", "setEventCallbackCount", luaGameSetEventCallbackCount);
 
 	registerMethod("Game", "getAccountStorageValue", luaGameGetAccountStorageValue);
 	registerMethod("Game", "setAccountStorageValue", luaGameSetAccountStorageValue);
@@ -66,8 +66,7 @@ int luaGuildGetMembersOnline(lua_State* L)
 
 	int index = 0;
 	for (Player* player : members) {
-		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		pushCreature(L, player);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
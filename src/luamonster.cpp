@@ -29,8 +29,7 @@ int luaMonsterCreate(lua_State* L)
 	}
 
 	if (monster) {
-		pushUserdata<Monster>(L, monster);
-		setMetatable(L, -1, "Monster");
+		pushCreature(L, monster);
 	} else {
 		lua_pushnil(L);
 	}
@@ -50,7 +49,7 @@ int luaMonsterGetId(lua_State* L)
 	Monster* monster = getUserdata<Monster>(L, 1);
 	if (monster) {
 		// Set monster id if it's not set yet (only for onSpawn event)
-		if (LuaScriptInterface::getScriptEnv()->getScriptId() == g_events->getScriptId(EventInfoId::MONSTER_ONSPAWN)) {
+		if (LuaScriptInterface::getScriptEnv()->getScriptId() == g_events->getScriptId(EventHook::MONSTER_ONSPAWN)) {
 			monster->setID();
 		}
 
@@ -273,8 +272,7 @@ int luaMonsterGetFriendList(lua_State* L)
 
 	int index = 0;
 	for (Creature* creature : friendList) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -349,8 +347,7 @@ int luaMonsterGetTargetList(lua_State* L)
 
 	int index = 0;
 	for (Creature* creature : targetList) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -32,8 +32,7 @@ int luaNpcCreate(lua_State* L)
 	}
 
 	if (npc) {
-		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		pushCreature(L, npc);
 	} else {
 		lua_pushnil(L);
 	}
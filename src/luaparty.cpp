@@ -61,8 +61,7 @@ int luaPartyGetLeader(lua_State* L)
 
 	Player* leader = party->getLeader();
 	if (leader) {
-		pushUserdata<Player>(L, leader);
-		setMetatable(L, -1, "Player");
+		pushCreature(L, leader);
 	} else {
 		lua_pushnil(L);
 	}
@@ -94,8 +93,7 @@ int luaPartyGetMembers(lua_State* L)
 	int index = 0;
 	lua_createtable(L, party->getMemberCount(), 0);
 	for (Player* player : party->getMembers()) {
-		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		pushCreature(L, player);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -122,8 +120,7 @@ int luaPartyGetInvitees(lua_State* L)
 
 		int index = 0;
 		for (Player* player : party->getInvitees()) {
-			pushUserdata<Player>(L, player);
-			setMetatable(L, -1, "Player");
+			pushCreature(L, player);
 			lua_rawseti(L, -2, ++index);
 		}
 	} else {
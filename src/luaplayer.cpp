@@ -31,7 +31,7 @@ int luaPlayerCreate(lua_State* L)
 	Player* player;
 	if (isInteger(L, 2)) {
 		uint32_t id = getInteger<uint32_t>(L, 2);
-		if (id >= 0x10000000 && id <= Player::playerAutoID) {
+		if (PlayerRegistry::contains(id)) {
 			player = g_game.getPlayerByID(id);
 		} else {
 			player = g_game.getPlayerByGUID(id);
@@ -50,8 +50,7 @@ int luaPlayerCreate(lua_State* L)
 	}
 
 	if (player) {
-		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		pushCreature(L, player);
 	} else {
 		lua_pushnil(L);
 	}
@@ -14,6 +14,8 @@
 #include "events.h"
 #include "game.h"
 #include "housetile.h"
+#include "iologindata.h"
+#include "luabytecodecache.h"
 #include "luavariant.h"
 #include "matrixarea.h"
 #include "monster.h"
@@ -22,6 +24,7 @@
 #include "protocolstatus.h"
 #include "scheduler.h"
 #include "script.h"
+#include "scriptprofiler.h"
 #include "spectators.h"
 #include "spells.h"
 #include "teleport.h"
@@ -36,6 +39,7 @@ extern Scripts* g_scripts;
 extern Spells* g_spells;
 
 ScriptEnvironment::DBResultMap ScriptEnvironment::tempResults;
+std::map<uint32_t, std::pair<lua_State*, DBResult_ptr>> ScriptEnvironment::awaitedResults;
 uint32_t ScriptEnvironment::lastResultId = 0;
 
 std::multimap<ScriptEnvironment*, Item*> ScriptEnvironment::tempItems;
@@ -197,11 +201,22 @@ uint32_t ScriptEnvironment::addResult(DBResult_ptr res)
 	return lastResultId;
 }
 
+uint32_t ScriptEnvironment::addAwaitedResult(lua_State* thread, DBResult_ptr res)
+{
+	awaitedResults[++lastResultId] = {thread, std::move(res)};
+	return lastResultId;
+}
+
+void ScriptEnvironment::removeAwaitedResults(lua_State* thread)
+{
+	std::erase_if(awaitedResults, [thread](const auto& it) { return it.second.first == thread; });
+}
+
 bool ScriptEnvironment::removeResult(uint32_t id)
 {
 	auto it = tempResults.find(id);
 	if (it == tempResults.end()) {
-		return false;
+		return awaitedResults.erase(id) != 0;
 	}
 
 	tempResults.erase(it);
@@ -212,7 +227,11 @@ DBResult_ptr ScriptEnvironment::getResultByID(uint32_t id)
 {
 	auto it = tempResults.find(id);
 	if (it == tempResults.end()) {
-		return nullptr;
+		auto awaited = awaitedResults.find(id);
+		if (awaited == awaitedResults.end()) {
+			return nullptr;
+		}
+		return awaited->second.second;
 	}
 	return it->second;
 }
@@ -256,8 +275,28 @@ std::string_view LuaScriptInterface::getErrorDesc(LuaErrorCode code)
 ScriptEnvironment LuaScriptInterface::scriptEnv[16];
 int32_t LuaScriptInterface::scriptEnvIndex = -1;
 
-LuaScriptInterface::LuaScriptInterface(std::string_view interfaceName) : interfaceName{interfaceName}
+namespace {
+
+// never destroyed, interfaces in static objects are destroyed in no particular order
+auto& liveInterfaces = *new std::unordered_map<uint32_t, LuaScriptInterface*>();
+uint32_t lastInterfaceId = 0;
+
+} // namespace
+
+LuaScriptInterface* LuaScriptInterface::getInterfaceById(uint32_t id)
 {
+	auto it = liveInterfaces.find(id);
+	if (it == liveInterfaces.end()) {
+		return nullptr;
+	}
+	return it->second;
+}
+
+LuaScriptInterface::LuaScriptInterface(std::string_view interfaceName) :
+    interfaceName{interfaceName}, interfaceId{++lastInterfaceId}
+{
+	liveInterfaces.emplace(interfaceId, this);
+
 	// Don't initialize g_luaEnvironment here if we ARE g_luaEnvironment
 	// This prevents infinite recursion during static initialization
 	if (this != &g_luaEnvironment && !g_luaEnvironment.getLuaState()) {
@@ -265,7 +304,11 @@ LuaScriptInterface::LuaScriptInterface(std::string_view interfaceName) : interfa
 	}
 }
 
-LuaScriptInterface::~LuaScriptInterface() { closeState(); }
+LuaScriptInterface::~LuaScriptInterface()
+{
+	closeState();
+	liveInterfaces.erase(interfaceId);
+}
 
 bool LuaScriptInterface::reInitState()
 {
@@ -276,22 +319,52 @@ bool LuaScriptInterface::reInitState()
 	return initState();
 }
 
+namespace {
+
+// profiler frame of the function at index: the file and line it is defined at, addEvent callbacks are marked as such
+std::string getProfilerFrame(lua_State* L, int index)
+{
+	lua_Debug ar;
+	lua_pushvalue(L, index);
+	lua_getinfo(L, ">S", &ar);
+
+	std::string_view source = ar.short_src;
+	if (ar.source && ar.source[0] == '@') {
+		source = ar.source + 1;
+	}
+
+	bool timerEvent = LuaScriptInterface::hasScriptEnv() && LuaScriptInterface::getScriptEnv()->isTimerEvent();
+	return fmt::format("{:s}{:s}:{:d}", timerEvent ? "addEvent " : "", source, ar.linedefined);
+}
+
+} // namespace
+
 /// Same as lua_pcall, but adds stack trace to error strings in called function.
 int LuaScriptInterface::protectedCall(lua_State* L, int nargs, int nresults)
 {
 	int error_index = lua_gettop(L) - nargs;
+	const bool profiled = g_scriptProfiler.isRunning();
+	if (profiled) {
+		g_scriptProfiler.enter(getProfilerFrame(L, error_index));
+	}
+
 	lua_pushcfunction(L, luaErrorHandler);
 	lua_insert(L, error_index);
 
 	int ret = lua_pcall(L, nargs, nresults, error_index);
 	lua_remove(L, error_index);
+
+	if (profiled) {
+		g_scriptProfiler.leave();
+	}
 	return ret;
 }
 
-int32_t LuaScriptInterface::loadFile(std::string_view file, Npc* npc /* = nullptr*/)
+int32_t LuaScriptInterface::loadFile(std::string_view file, Npc* npc /* = nullptr*/,
+                                     int32_t environmentRef /* = -1*/)
 {
 	// loads file as a chunk at stack top
-	int ret = luaL_loadfile(luaState, file.data());
+	int ret = LuaBytecodeCache::loadFile(luaState, std::string{file});
 	if (ret != 0) {
 		lastLuaError = Lua::popString(luaState);
 		return -1;
@@ -303,7 +376,18 @@ int32_t LuaScriptInterface::loadFile(std::string_view file, Npc* npc /* = nullpt
 		return -1;
 	}
 
+	if (environmentRef != -1) {
+		lua_rawgeti(luaState, LUA_REGISTRYINDEX, environmentRef);
+#if defined(LUAJIT_VERSION)
+		lua_setfenv(luaState, -2);
+#else
+		// the only upvalue of a main chunk is _ENV
+		lua_setupvalue(luaState, -2, 1);
+#endif
+	}
+
 	loadingFile = file;
+	g_luaEnvironment.lastAllocationStats = nullptr;
 
 	if (!reserveScriptEnv()) {
 		lua_pop(luaState, 1);
@@ -427,6 +511,7 @@ void LuaScriptInterface::removeEvent(int32_t scriptId)
 	lua_rawseti(luaState, -2, scriptId);
 	lua_pop(luaState, 1);
 
+	g_luaEnvironment.resolveAllocationStats(this, scriptId);
 	cacheFiles.erase(scriptId);
 }
 
@@ -530,6 +615,12 @@ bool LuaScriptInterface::closeState()
 		return false;
 	}
 
+	// the script ids handed out so far are gone with the state
+	liveInterfaces.erase(interfaceId);
+	interfaceId = ++lastInterfaceId;
+	liveInterfaces.emplace(interfaceId, this);
+
+	g_luaEnvironment.resolveAllocationStats(this);
 	cacheFiles.clear();
 	if (eventTableRef != -1) {
 		luaL_unref(luaState, LUA_REGISTRYINDEX, eventTableRef);
@@ -638,8 +729,7 @@ void Lua::pushThing(lua_State* L, Thing* thing)
 		pushUserdata<Item>(L, item);
 		setItemMetatable(L, -1, item);
 	} else if (Creature* creature = thing->getCreature()) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -648,8 +738,7 @@ void Lua::pushThing(lua_State* L, Thing* thing)
 void Lua::pushCylinder(lua_State* L, Cylinder* cylinder)
 {
 	if (Creature* creature = cylinder->getCreature()) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 	} else if (Item* parentItem = cylinder->getItem()) {
 		pushUserdata<Item>(L, parentItem);
 		setItemMetatable(L, -1, parentItem);
@@ -680,6 +769,68 @@ std::string Lua::popString(lua_State* L)
 
 int32_t Lua::popCallback(lua_State* L) { return luaL_ref(L, LUA_REGISTRYINDEX); }
 
+namespace {
+
+// registry key of the userdata cache table
+const char userdataCacheKey = 0;
+
+void pushUserdataCache(lua_State* L)
+{
+	if (lua_rawgetp(L, LUA_REGISTRYINDEX, &userdataCacheKey) == LUA_TTABLE) {
+		return;
+	}
+
+	lua_pop(L, 1);
+	lua_newtable(L);
+
+	lua_createtable(L, 0, 1);
+	Lua::pushString(L, "v");
+	lua_setfield(L, -2, "__mode");
+	lua_setmetatable(L, -2);
+
+	lua_pushvalue(L, -1);
+	lua_rawsetp(L, LUA_REGISTRYINDEX, &userdataCacheKey);
+}
+
+} // namespace
+
+void Lua::pushCreature(lua_State* L, Creature* creature)
+{
+	// the creature registry retires an id instead of handing it out twice, offline players have none and are not
+	// cached
+	uint32_t id = creature->getID();
+	if (id != 0 && pushCachedUserdata(L, id, creature)) {
+		return;
+	}
+
+	pushUserdata<Creature>(L, creature);
+	setCreatureMetatable(L, -1, creature);
+	if (id != 0) {
+		cacheUserdata(L, id);
+	}
+}
+
+// Userdata cache
+bool Lua::pushCachedUserdata(lua_State* L, lua_Integer key, const void* value)
+{
+	pushUserdataCache(L);
+	if (lua_rawgeti(L, -1, key) == LUA_TUSERDATA && *static_cast<const void**>(lua_touserdata(L, -1)) == value) {
+		lua_remove(L, -2);
+		return true;
+	}
+
+	lua_pop(L, 2);
+	return false;
+}
+
+void Lua::cacheUserdata(lua_State* L, lua_Integer key)
+{
+	pushUserdataCache(L);
+	lua_pushvalue(L, -2);
+	lua_rawseti(L, -2, key);
+	lua_pop(L, 1);
+}
+
 // Metatables
 void Lua::setMetatable(lua_State* L, int32_t index, std::string_view name)
 {
@@ -2925,50 +3076,55 @@ int LuaScriptInterface::luaAddEvent(lua_State* L)
 		}
 	}
 
-	LuaTimerEventDesc eventDesc;
-	eventDesc.parameters.reserve(parameters -
-	                             2); // safe to use -2 since we garanteed that there is at least two parameters
+	uint32_t delay = std::max<uint32_t>(100, Lua::getInteger<uint32_t>(L, 2));
+	auto& timerEvents = g_luaEnvironment.timerEvents;
+	uint64_t eventId = timerEvents.add(OTSYS_TIME() + delay);
+	if (eventId == 0) {
+		reportErrorFunc(L, "Too many pending events.");
+		Lua::pushBoolean(L, false);
+		return 1;
+	}
+
+	// safe to use -2 since we garanteed that there is at least two parameters; taking a reference can run a
+	// finalizer that adds an event and moves the descriptor, so it is looked up again for each one
 	for (int i = 0; i < parameters - 2; ++i) {
-		eventDesc.parameters.push_back(luaL_ref(L, LUA_REGISTRYINDEX));
+		int32_t parameter = luaL_ref(L, LUA_REGISTRYINDEX);
+		timerEvents.find(eventId)->parameters.push_back(parameter);
 	}
 
-	uint32_t delay = std::max<uint32_t>(100, Lua::getInteger<uint32_t>(L, 2));
 	lua_pop(L, 1);
 
-	eventDesc.function = luaL_ref(L, LUA_REGISTRYINDEX);
-	eventDesc.scriptId = getScriptEnv()->getScriptId();
-
-	auto& lastTimerEventId = g_luaEnvironment.lastEventTimerId;
-	eventDesc.eventId = g_scheduler.addEvent(
-	    createSchedulerTask(delay, [=]() { g_luaEnvironment.executeTimerEvent(lastTimerEventId); }));
+	int32_t function = luaL_ref(L, LUA_REGISTRYINDEX);
+	LuaTimerEventDesc* eventDesc = timerEvents.find(eventId);
+	eventDesc->function = function;
+	eventDesc->scriptId = getScriptEnv()->getScriptId();
 
-	g_luaEnvironment.timerEvents.emplace(lastTimerEventId, std::move(eventDesc));
-	lua_pushinteger(L, lastTimerEventId++);
+	g_luaEnvironment.scheduleTimerEvents();
+	lua_pushinteger(L, static_cast<lua_Integer>(eventId));
 	return 1;
 }
 
 int LuaScriptInterface::luaStopEvent(lua_State* L)
 {
 	// stopEvent(eventId)
-	uint32_t eventId = Lua::getInteger<uint32_t>(L, 1);
+	uint64_t eventId = Lua::getInteger<uint64_t>(L, 1);
 
 	auto& timerEvents = g_luaEnvironment.timerEvents;
-	auto it = timerEvents.find(eventId);
-	if (it == timerEvents.end()) {
+	LuaTimerEventDesc* timerEventDesc = timerEvents.find(eventId);
+	if (!timerEventDesc) {
 		Lua::pushBoolean(L, false);
 		return 1;
 	}
 
-	LuaTimerEventDesc timerEventDesc = std::move(it->second);
-	timerEvents.erase(it);
-
-	g_scheduler.stopEvent(timerEventDesc.eventId);
-	luaL_unref(L, LUA_REGISTRYINDEX, timerEventDesc.function);
-
-	for (auto parameter : timerEventDesc.parameters) {
+	luaL_unref(L, LUA_REGISTRYINDEX, timerEventDesc->function);
+	for (auto parameter : timerEventDesc->parameters) {
 		luaL_unref(L, LUA_REGISTRYINDEX, parameter);
 	}
 
+	// the scheduled pulse skips it, it only has to leave the pool
+	timerEventDesc->parameters.clear();
+	timerEvents.erase(eventId);
+
 	Lua::pushBoolean(L, true);
 	return 1;
 }
@@ -3102,11 +3258,43 @@ int LuaScriptInterface::luaConfigManagerGetBoolean(lua_State* L)
 	return 1;
 }
 
+namespace {
+
+// db.query and db.storeQuery wait for the database on the dispatcher, warn about the script when that took too long
+void checkSlowQuery(std::string_view function, std::string_view query, std::chrono::steady_clock::time_point start)
+{
+	int64_t limit = getInteger(ConfigManager::SLOW_QUERY_WARNING);
+	if (limit <= 0) {
+		return;
+	}
+
+	auto elapsed =
+	    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	if (elapsed < limit) {
+		return;
+	}
+
+	std::string script = "unknown script";
+	if (LuaScriptInterface::hasScriptEnv()) {
+		ScriptEnvironment* env = LuaScriptInterface::getScriptEnv();
+		if (LuaScriptInterface* interface = env->getScriptInterface()) {
+			script =
+			    fmt::format("{:s}: {:s}", interface->getInterfaceName(), interface->getFileById(env->getScriptId()));
+		}
+	}
+
+	std::cout << "[Warning - " << function << "] " << script << " blocked the dispatcher for " << elapsed
+	          << " ms: " << query.substr(0, 200) << std::endl;
+}
+
+} // namespace
+
 const luaL_Reg LuaScriptInterface::luaDatabaseTable[] = {
     {"query", LuaScriptInterface::luaDatabaseExecute},
     {"asyncQuery", LuaScriptInterface::luaDatabaseAsyncExecute},
     {"storeQuery", LuaScriptInterface::luaDatabaseStoreQuery},
     {"asyncStoreQuery", LuaScriptInterface::luaDatabaseAsyncStoreQuery},
+    {"await", LuaScriptInterface::luaDatabaseAwait},
     {"escapeString", LuaScriptInterface::luaDatabaseEscapeString},
     {"escapeBlob", LuaScriptInterface::luaDatabaseEscapeBlob},
     {"lastInsertId", LuaScriptInterface::luaDatabaseLastInsertId},
@@ -3115,7 +3303,11 @@ const luaL_Reg LuaScriptInterface::luaDatabaseTable[] = {
 
 int LuaScriptInterface::luaDatabaseExecute(lua_State* L)
 {
-	Lua::pushBoolean(L, Database::getInstance().executeQuery(Lua::getString(L, -1)));
+	const std::string query = Lua::getString(L, -1);
+	auto start = std::chrono::steady_clock::now();
+	IOLoginData::notifyUnknownWrite();
+	Lua::pushBoolean(L, Database::getInstance().executeQuery(query));
+	checkSlowQuery("db.query", query, start);
 	return 1;
 }
 
@@ -3145,13 +3337,19 @@ int LuaScriptInterface::luaDatabaseAsyncExecute(lua_State* L)
 			luaL_unref(luaState, LUA_REGISTRYINDEX, ref);
 		};
 	}
+	IOLoginData::notifyUnknownWrite();
 	g_databaseTasks.addTask(Lua::getString(L, -1), callback);
 	return 0;
 }
 
 int LuaScriptInterface::luaDatabaseStoreQuery(lua_State* L)
 {
-	if (DBResult_ptr res = Database::getInstance().storeQuery(Lua::getString(L, -1))) {
+	const std::string query = Lua::getString(L, -1);
+	auto start = std::chrono::steady_clock::now();
+	DBResult_ptr res = Database::getInstance().storeQuery(query);
+	checkSlowQuery("db.storeQuery", query, start);
+
+	if (res) {
 		lua_pushinteger(L, ScriptEnvironment::addResult(res));
 	} else {
 		Lua::pushBoolean(L, false);
@@ -3193,6 +3391,111 @@ int LuaScriptInterface::luaDatabaseAsyncStoreQuery(lua_State* L)
 	return 0;
 }
 
+namespace {
+
+// yielded by a coroutine suspended in db.await, to tell it from a coroutine yielding for anything else
+const char awaitYieldKey = 0;
+
+} // namespace
+
+LuaScriptInterface::AwaitHandle LuaScriptInterface::prepareAwait(lua_State* L)
+{
+	ScriptEnvironment* env = getScriptEnv();
+	LuaScriptInterface* interface = env->getScriptInterface();
+	lua_pushthread(L);
+	return {luaL_ref(L, LUA_REGISTRYINDEX), interface ? interface->getInterfaceId() : 0, env->getScriptId()};
+}
+
+int LuaScriptInterface::yieldAwait(lua_State* L)
+{
+	lua_pushlightuserdata(L, const_cast<char*>(&awaitYieldKey));
+	return lua_yield(L, 1);
+}
+
+void LuaScriptInterface::resumeAwait(const AwaitHandle& handle, const DBResult_ptr& result)
+{
+	lua_State* L = g_luaEnvironment.getLuaState();
+	if (!L) {
+		return;
+	}
+
+	// the reference keeps the coroutine alive until it yields again or ends
+	lua_rawgeti(L, LUA_REGISTRYINDEX, handle.threadRef);
+	lua_State* thread = lua_tothread(L, -1);
+	lua_pop(L, 1);
+	if (!thread) {
+		luaL_unref(L, LUA_REGISTRYINDEX, handle.threadRef);
+		return;
+	}
+
+	// the interface may have been reloaded or destroyed while the query ran, its script ids mean nothing then
+	LuaScriptInterface* interface = getInterfaceById(handle.interfaceId);
+	int32_t scriptId = interface ? handle.scriptId : 0;
+	if (!interface) {
+		interface = &g_luaEnvironment;
+	}
+
+	if (!reserveScriptEnv()) {
+		unreserveScriptEnv();
+		ScriptEnvironment::removeAwaitedResults(thread);
+		luaL_unref(L, LUA_REGISTRYINDEX, handle.threadRef);
+		std::cout << "[Error - db.await] Call stack overflow, dropped the coroutine of "
+		          << interface->getFileById(scriptId) << std::endl;
+		return;
+	}
+
+	getScriptEnv()->setScriptId(scriptId, interface);
+	if (result) {
+		lua_pushinteger(thread, ScriptEnvironment::addAwaitedResult(thread, result));
+	} else {
+		Lua::pushBoolean(thread, false);
+	}
+
+#if defined(LUAJIT_VERSION)
+	int status = lua_resume(thread, 1);
+#else
+	int results;
+	int status = lua_resume(thread, L, 1, &results);
+#endif
+	// a coroutine that yields for anything but db.await is not resumed by us again, so it loses its results like
+	// one that ends
+	bool awaiting = status == LUA_YIELD && lua_gettop(thread) == 1 && lua_touserdata(thread, -1) == &awaitYieldKey;
+	if (status == LUA_OK || status == LUA_YIELD) {
+		// nobody receives what the coroutine returns or yields
+		lua_settop(thread, 0);
+	} else {
+		reportError(nullptr, Lua::popString(thread), thread, true);
+	}
+
+	if (!awaiting) {
+		ScriptEnvironment::removeAwaitedResults(thread);
+	}
+	resetScriptEnv();
+	luaL_unref(L, LUA_REGISTRYINDEX, handle.threadRef);
+}
+
+int LuaScriptInterface::luaDatabaseAwait(lua_State* L)
+{
+	// db.await(query)
+	// runs the query on the database thread and suspends the calling coroutine until it is done, returns the result id
+	// or false like db.storeQuery; the result stays valid until result.free, the end of the coroutine or a yield that
+	// is not db.await
+#if defined(LUAJIT_VERSION)
+	bool mainThread = lua_pushthread(L) == 1;
+	lua_pop(L, 1);
+	if (mainThread) {
+#else
+	if (!lua_isyieldable(L)) {
+#endif
+		return luaL_error(L, "db.await can only be called from a coroutine, use db.storeQuery or db.asyncStoreQuery");
+	}
+
+	g_databaseTasks.addTask(
+	    Lua::getString(L, 1),
+	    [handle = prepareAwait(L)](DBResult_ptr result, bool) { resumeAwait(handle, result); }, true);
+	return yieldAwait(L);
+}
+
 int LuaScriptInterface::luaDatabaseEscapeString(lua_State* L)
 {
 	Lua::pushString(L, Database::getInstance().escapeString(Lua::getString(L, -1)));
@@ -3362,8 +3665,15 @@ bool LuaEnvironment::initState()
 		return false;
 	}
 
+#if !defined(LUAJIT_VERSION)
+	// LuaJIT does not support custom allocators on 64-bit, so there is no per-script accounting with it
+	defaultAlloc = lua_getallocf(luaState, &defaultAllocData);
+	lua_setallocf(luaState, accountingAlloc, this);
+#endif
+
 	luaL_openlibs(luaState);
 	registerFunctions();
+	configureGarbageCollector();
 
 	runningEventId = EVENT_ID_USER;
 	return true;
@@ -3390,17 +3700,20 @@ bool LuaEnvironment::closeState()
 		clearAreaObjects(areaEntry.first);
 	}
 
-	for (auto& timerEntry : timerEvents) {
-		LuaTimerEventDesc timerEventDesc = std::move(timerEntry.second);
+	timerEvents.forEach([this](LuaTimerEventDesc& timerEventDesc) {
 		for (int32_t parameter : timerEventDesc.parameters) {
 			luaL_unref(luaState, LUA_REGISTRYINDEX, parameter);
 		}
 		luaL_unref(luaState, LUA_REGISTRYINDEX, timerEventDesc.function);
-	}
+	});
+
+	g_scheduler.stopEvent(timerPulseEventId);
+	timerPulseEventId = 0;
 
 	combatIdMap.clear();
 	areaIdMap.clear();
 	timerEvents.clear();
+	resolveAllocationStats(this);
 	cacheFiles.clear();
 
 	lua_close(luaState);
@@ -3408,6 +3721,150 @@ bool LuaEnvironment::closeState()
 	return true;
 }
 
+void LuaEnvironment::configureGarbageCollector()
+{
+	if (!luaState) {
+		return;
+	}
+
+	// zero leaves a parameter unchanged, which keeps Lua's defaults before the config is loaded
+	// lua_gc takes its parameters as varargs, they have to be passed as int
+	int pause = static_cast<int>(getInteger(ConfigManager::LUA_GC_PAUSE));
+	int stepMultiplier = static_cast<int>(getInteger(ConfigManager::LUA_GC_STEP_MULTIPLIER));
+	idleStepSize = static_cast<int32_t>(std::max<int64_t>(0, getInteger(ConfigManager::LUA_GC_IDLE_STEP)));
+	collectedUpToBytes = allocatedBytes;
+
+	auto mode = getString(ConfigManager::LUA_GC_MODE);
+	if (!mode.empty() && !caseInsensitiveEqual(mode, "incremental") && !caseInsensitiveEqual(mode, "generational")) {
+		std::cout << "[Warning - LuaEnvironment::configureGarbageCollector] Unknown luaGcMode " << mode
+		          << ", using incremental." << std::endl;
+	}
+
+#if LUA_VERSION_NUM >= 504
+	if (caseInsensitiveEqual(mode, "generational")) {
+		lua_gc(luaState, LUA_GCGEN, static_cast<int>(getInteger(ConfigManager::LUA_GC_MINOR_MULTIPLIER)),
+		       static_cast<int>(getInteger(ConfigManager::LUA_GC_MAJOR_MULTIPLIER)));
+		incrementalGc = false;
+		return;
+	}
+
+	lua_gc(luaState, LUA_GCINC, pause, stepMultiplier, 0);
+#else
+	if (pause != 0) {
+		lua_gc(luaState, LUA_GCSETPAUSE, pause);
+	}
+	if (stepMultiplier != 0) {
+		lua_gc(luaState, LUA_GCSETSTEPMUL, stepMultiplier);
+	}
+#endif
+	incrementalGc = true;
+}
+
+void LuaEnvironment::collectGarbageStep()
+{
+	if (!luaState || !incrementalGc || idleStepSize == 0) {
+		return;
+	}
+
+	const uint64_t stepBytes = static_cast<uint64_t>(idleStepSize) * 1024;
+	if (allocatedBytes - collectedUpToBytes < stepBytes) {
+		return;
+	}
+
+	// a backlog of more than a few steps is left to the collector's own steps, idle time is no longer idle once there
+	// are tasks waiting
+	if (allocatedBytes - collectedUpToBytes > 4 * stepBytes) {
+		collectedUpToBytes = allocatedBytes - 4 * stepBytes;
+	}
+	collectedUpToBytes += stepBytes;
+
+	lua_gc(luaState, LUA_GCSTEP, idleStepSize);
+}
+
+namespace {
+
+std::string getAllocationName(LuaScriptInterface* interface, int32_t scriptId)
+{
+	if (!interface) {
+		return "(no script)";
+	}
+	return fmt::format("{:s}: {:s}", interface->getInterfaceName(), interface->getFileById(scriptId));
+}
+
+void addAllocationStats(LuaAllocationStats& stats, const LuaAllocationStats& other)
+{
+	stats.bytes += other.bytes;
+	stats.allocations += other.allocations;
+}
+
+} // namespace
+
+std::map<std::string, LuaAllocationStats, std::less<>> LuaEnvironment::getAllocationStats() const
+{
+	auto stats = namedAllocationStats;
+	for (const auto& [key, scriptStats] : allocationStats) {
+		addAllocationStats(stats[getAllocationName(key.first, key.second)], scriptStats);
+	}
+	return stats;
+}
+
+void LuaEnvironment::resetAllocationStats()
+{
+	allocationStats.clear();
+	namedAllocationStats.clear();
+	lastAllocationStats = nullptr;
+}
+
+void LuaEnvironment::resolveAllocationStats(LuaScriptInterface* interface, int32_t scriptId)
+{
+	auto it = allocationStats.lower_bound({interface, scriptId});
+	while (it != allocationStats.end() && it->first.first == interface &&
+	       (scriptId == 0 || it->first.second == scriptId)) {
+		addAllocationStats(namedAllocationStats[getAllocationName(interface, it->first.second)], it->second);
+		it = allocationStats.erase(it);
+	}
+	lastAllocationStats = nullptr;
+}
+
+void* LuaEnvironment::accountingAlloc(void* ud, void* ptr, size_t osize, size_t nsize)
+{
+	auto environment = static_cast<LuaEnvironment*>(ud);
+
+	// osize is the type of the new object, not a size, when ptr is null
+	const size_t oldSize = ptr ? osize : 0;
+	if (nsize > oldSize) {
+		environment->accountAllocation(nsize - oldSize);
+	}
+	return environment->defaultAlloc(environment->defaultAllocData, ptr, osize, nsize);
+}
+
+void LuaEnvironment::accountAllocation(size_t bytes)
+{
+	allocatedBytes += bytes;
+
+	LuaScriptInterface* interface = nullptr;
+	int32_t scriptId = 0;
+	if (hasScriptEnv()) {
+		ScriptEnvironment* env = getScriptEnv();
+		interface = env->getScriptInterface();
+		scriptId = env->getScriptId();
+	}
+
+	if (!lastAllocationStats || interface != lastAllocationInterface || scriptId != lastAllocationScriptId) {
+		if (scriptId == EVENT_ID_LOADING) {
+			// every file is loaded under the same id, loadFile drops lastAllocationStats when the file changes
+			lastAllocationStats = &namedAllocationStats[getAllocationName(interface, scriptId)];
+		} else {
+			lastAllocationStats = &allocationStats[{interface, scriptId}];
+		}
+		lastAllocationInterface = interface;
+		lastAllocationScriptId = scriptId;
+	}
+
+	lastAllocationStats->bytes += bytes;
+	++lastAllocationStats->allocations;
+}
+
 LuaScriptInterface* LuaEnvironment::getTestInterface()
 {
 	if (!testInterface) {
@@ -3483,68 +3940,116 @@ void LuaEnvironment::clearAreaObjects(LuaScriptInterface* interface)
 	it->second.clear();
 }
 
-void LuaEnvironment::executeTimerEvent(uint32_t eventIndex)
+void LuaEnvironment::scheduleTimerEvents()
 {
-	if (!timerEvents.contains(eventIndex)) {
+	auto nextTime = timerEvents.nextDueTime();
+	if (!nextTime) {
 		return;
 	}
 
-	LuaTimerEventDesc timerEventDesc = std::move(timerEvents[eventIndex]);
-	timerEvents.erase(eventIndex);
+	if (timerPulseEventId != 0) {
+		if (timerPulseTime <= *nextTime) {
+			return;
+		}
+		g_scheduler.stopEvent(timerPulseEventId);
+	}
+
+	// a stopped pulse may have been handed to the dispatcher already, it then runs without being the armed one
+	uint64_t pulse = ++lastTimerPulse;
+	uint32_t delay = static_cast<uint32_t>(std::max<int64_t>(0, *nextTime - OTSYS_TIME()));
+	timerPulseTime = *nextTime;
+	timerPulseEventId =
+	    g_scheduler.addEvent(createSchedulerTask(delay, [this, pulse]() { executeTimerEvents(pulse); }));
+}
 
-	// push function
-	lua_rawgeti(luaState, LUA_REGISTRYINDEX, timerEventDesc.function);
+void LuaEnvironment::executeTimerEvents(uint64_t pulse)
+{
+	if (pulse == lastTimerPulse) {
+		timerPulseEventId = 0;
+	}
 
-	// push parameters
-	for (auto parameter : boost::adaptors::reverse(timerEventDesc.parameters)) {
-		lua_rawgeti(luaState, LUA_REGISTRYINDEX, parameter);
-		if (lua_getmetatable(luaState, -1) == 0) {
-			continue;
-		}
+	if (!luaState) {
+		return;
+	}
 
-		lua_rawgeti(luaState, -1, 't');
-		auto type = Lua::getInteger<LuaDataType>(luaState, -1);
-		lua_pop(luaState, 2);
+	// every timer due runs in this one script environment, it is reset between them
+	if (!reserveScriptEnv()) {
+		std::cout << "[Error - LuaScriptInterface::executeTimerEvents] Call stack overflow" << std::endl;
+		scheduleTimerEvents();
+		return;
+	}
 
-		switch (type) {
-			case LuaData_Player:
-			case LuaData_Monster:
-			case LuaData_Npc: {
-				if (lua_getiuservalue(luaState, -1, 1)) {
-					auto creatureId = Lua::getInteger<uint32_t>(luaState, -1);
-					if (auto creature = g_game.getCreatureByID(creatureId)) {
-						Lua::pushUserdata<Creature>(luaState, creature);
-						Lua::setCreatureMetatable(luaState, -1, creature);
-					} else {
-						lua_pushnil(luaState);
+	ScriptEnvironment* env = getScriptEnv();
+	const int64_t now = OTSYS_TIME();
+	while (uint64_t eventId = timerEvents.nextDue(now)) {
+		LuaTimerEventDesc* timerEventDesc = timerEvents.find(eventId);
+		int32_t scriptId = timerEventDesc->scriptId;
+		int32_t function = timerEventDesc->function;
+		int parameters = static_cast<int>(timerEventDesc->parameters.size());
+
+		// the slot can take the next addEvent right away, even one from a finalizer run while pushing the
+		// parameters; swapping keeps both vectors' memory for reuse
+		timerParameters.clear();
+		timerParameters.swap(timerEventDesc->parameters);
+		timerEvents.erase(eventId);
+
+		// push function
+		lua_rawgeti(luaState, LUA_REGISTRYINDEX, function);
+		luaL_unref(luaState, LUA_REGISTRYINDEX, function);
+
+		// push parameters
+		for (auto parameter : boost::adaptors::reverse(timerParameters)) {
+			lua_rawgeti(luaState, LUA_REGISTRYINDEX, parameter);
+			luaL_unref(luaState, LUA_REGISTRYINDEX, parameter);
+			if (lua_getmetatable(luaState, -1) == 0) {
+				continue;
+			}
+
+			lua_rawgeti(luaState, -1, 't');
+			auto type = Lua::getInteger<LuaDataType>(luaState, -1);
+			lua_pop(luaState, 2);
+
+			switch (type) {
+				case LuaData_Player:
+				case LuaData_Monster:
+				case LuaData_Npc: {
+					if (lua_getiuservalue(luaState, -1, 1)) {
+						auto creatureId = Lua::getInteger<uint32_t>(luaState, -1);
+						if (auto creature = g_game.getCreatureByID(creatureId)) {
+							Lua::pushCreature(luaState, creature);
+						} else {
+							lua_pushnil(luaState);
+						}
+
+						lua_replace(luaState, -3);
 					}
 
-					lua_replace(luaState, -3);
+					lua_pop(luaState, 1);
+					break;
 				}
 
-				lua_pop(luaState, 1);
-				break;
-			}
-
-			default: {
-				break;
+				default: {
+					break;
+				}
 			}
 		}
-	}
 
-	// call the function
-	if (reserveScriptEnv()) {
-		ScriptEnvironment* env = getScriptEnv();
+		// call the function
 		env->setTimerEvent();
-		env->setScriptId(timerEventDesc.scriptId, this);
-		callFunction(timerEventDesc.parameters.size());
-	} else {
-		std::cout << "[Error - LuaScriptInterface::executeTimerEvent] Call stack overflow" << std::endl;
-	}
+		env->setScriptId(scriptId, this);
+
+		int size = lua_gettop(luaState);
+		if (protectedCall(luaState, parameters, 0) != 0) {
+			reportError(nullptr, Lua::popString(luaState));
+		}
 
-	// free resources
-	luaL_unref(luaState, LUA_REGISTRYINDEX, timerEventDesc.function);
-	for (auto parameter : timerEventDesc.parameters) {
-		luaL_unref(luaState, LUA_REGISTRYINDEX, parameter);
+		if ((lua_gettop(luaState) + parameters + 1) != size) {
+			reportError(nullptr, "Stack size changed!");
+		}
+
+		env->resetEnv();
 	}
+
+	resetScriptEnv();
+	scheduleTimerEvents();
 }
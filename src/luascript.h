@@ -6,6 +6,7 @@
 
 #include "database.h"
 #include "enums.h"
+#include "luatimerpool.h"
 #include "position.h"
 #include "spectators.h"
 
@@ -165,12 +166,17 @@ NEW_LUA_DATA_TYPE(Weapon)
 NEW_LUA_DATA_TYPE(XMLDocument)
 NEW_LUA_DATA_TYPE(XMLNode)
 
+struct LuaAllocationStats
+{
+	uint64_t bytes = 0;
+	uint64_t allocations = 0;
+};
+
 struct LuaTimerEventDesc
 {
 	int32_t scriptId = -1;
 	int32_t function = -1;
 	std::vector<int32_t> parameters;
-	uint32_t eventId = 0;
 
 	LuaTimerEventDesc() = default;
 	LuaTimerEventDesc(LuaTimerEventDesc&& other) = default;
@@ -200,6 +206,7 @@ public:
 	void setScriptInterface(LuaScriptInterface* scriptInterface) { interface = scriptInterface; }
 
 	void setTimerEvent() { timerEvent = true; }
+	bool isTimerEvent() const { return timerEvent; }
 
 	void getEventInfo(int32_t& scriptId, LuaScriptInterface*& scriptInterface, int32_t& callbackId,
 	                  bool& timerEvent) const;
@@ -211,6 +218,10 @@ public:
 
 	static DBResult_ptr getResultByID(uint32_t id);
 	static uint32_t addResult(DBResult_ptr res);
+	// results handed to a coroutine by db.await outlive the environment, they are kept until result.free or until
+	// the coroutine ends
+	static uint32_t addAwaitedResult(lua_State* thread, DBResult_ptr res);
+	static void removeAwaitedResults(lua_State* thread);
 	static bool removeResult(uint32_t id);
 
 	void setNpc(Npc* npc) { curNpc = npc; }
@@ -245,6 +256,7 @@ private:
 	// result map
 	static uint32_t lastResultId;
 	static DBResultMap tempResults;
+	static std::map<uint32_t, std::pair<lua_State*, DBResult_ptr>> awaitedResults;
 };
 
 #define reportErrorFunc(L, a) LuaScriptInterface::reportError(__FUNCTION__, a, L, true)
@@ -280,7 +292,8 @@ public:
 	virtual bool initState();
 	bool reInitState();
 
-	int32_t loadFile(std::string_view file, Npc* npc = nullptr);
+	// environmentRef is a registry reference to the table the chunk uses for its globals, -1 to use the global table
+	int32_t loadFile(std::string_view file, Npc* npc = nullptr, int32_t environmentRef = -1);
 
 	std::string_view getFileById(int32_t scriptId);
 	int32_t getEvent(std::string_view eventName);
@@ -294,7 +307,11 @@ public:
 		return scriptEnv + scriptEnvIndex;
 	}
 
+	static bool hasScriptEnv() { return scriptEnvIndex >= 0 && scriptEnvIndex < 16; }
+
 	static bool reserveScriptEnv() { return ++scriptEnvIndex < 16; }
+	// undoes a reserveScriptEnv that failed, there is no environment to reset
+	static void unreserveScriptEnv() { --scriptEnvIndex; }
 
 	static void resetScriptEnv()
 	{
@@ -305,6 +322,22 @@ public:
 	static void reportError(const char* function, std::string_view error_desc, lua_State* L = nullptr,
 	                        bool stack_trace = false);
 
+	// a coroutine suspended in db.await, resumeAwait hands it the result of its query
+	struct AwaitHandle
+	{
+		int32_t threadRef;
+		uint32_t interfaceId;
+		int32_t scriptId;
+	};
+	// keeps the running coroutine of L alive until it is resumed, the calling function then returns yieldAwait(L)
+	static AwaitHandle prepareAwait(lua_State* L);
+	static int yieldAwait(lua_State* L);
+	static void resumeAwait(const AwaitHandle& handle, const DBResult_ptr& result);
+
+	// identifies the interface until it is destroyed or its state is closed, getInterfaceById returns nullptr after
+	uint32_t getInterfaceId() const { return interfaceId; }
+	static LuaScriptInterface* getInterfaceById(uint32_t id);
+
 	std::string_view getInterfaceName() const { return interfaceName; }
 	std::string_view getLastLuaError() const { return lastLuaError; }
 
@@ -320,7 +353,7 @@ public:
 	static std::string escapeString(std::string string);
 
 	static const luaL_Reg luaConfigManagerTable[4];
-	static const luaL_Reg luaDatabaseTable[9];
+	static const luaL_Reg luaDatabaseTable[10];
 	static const luaL_Reg luaResultTable[6];
 
 	static int protectedCall(lua_State* L, int nargs, int nresults);
@@ -449,6 +482,7 @@ private:
 	static int luaDatabaseAsyncExecute(lua_State* L);
 	static int luaDatabaseStoreQuery(lua_State* L);
 	static int luaDatabaseAsyncStoreQuery(lua_State* L);
+	static int luaDatabaseAwait(lua_State* L);
 	static int luaDatabaseEscapeString(lua_State* L);
 	static int luaDatabaseEscapeBlob(lua_State* L);
 	static int luaDatabaseLastInsertId(lua_State* L);
@@ -479,6 +513,7 @@ private:
 	std::string lastLuaError;
 
 	std::string interfaceName;
+	uint32_t interfaceId = 0;
 
 	static ScriptEnvironment scriptEnv[16];
 	static int32_t scriptEnvIndex;
@@ -510,10 +545,31 @@ public:
 	uint32_t createAreaObject(LuaScriptInterface* interface);
 	void clearAreaObjects(LuaScriptInterface* interface);
 
+	// applies the luaGc* config values, called again when the config is reloaded
+	void configureGarbageCollector();
+	// in incremental mode, does the collection work owed for the memory allocated since the last call, the
+	// dispatcher calls it when it runs out of tasks
+	void collectGarbageStep();
+
+	// bytes allocated by each script since the server started or the stats were reset, keyed by
+	// "interface: file:event"
+	std::map<std::string, LuaAllocationStats, std::less<>> getAllocationStats() const;
+	void resetAllocationStats();
+	// names the stats kept by script id before the interface forgets the file, all of its scripts when scriptId is 0
+	void resolveAllocationStats(LuaScriptInterface* interface, int32_t scriptId = 0);
+	uint64_t getAllocatedBytes() const { return allocatedBytes; }
+
 private:
-	void executeTimerEvent(uint32_t eventIndex);
+	// arms the scheduler event running executeTimerEvents for the first pending timer, unless one that fires early
+	// enough is armed already
+	void scheduleTimerEvents();
+	void executeTimerEvents(uint64_t pulse);
+
+	static void* accountingAlloc(void* ud, void* ptr, size_t osize, size_t nsize);
+	void accountAllocation(size_t bytes);
 
-	std::unordered_map<uint32_t, LuaTimerEventDesc> timerEvents;
+	LuaTimerPool<LuaTimerEventDesc> timerEvents;
+	std::vector<int32_t> timerParameters;
 	std::unordered_map<uint32_t, Combat_ptr> combatMap;
 	std::unordered_map<uint32_t, AreaCombat*> areaMap;
 
@@ -522,10 +578,31 @@ private:
 
 	LuaScriptInterface* testInterface = nullptr;
 
-	uint32_t lastEventTimerId = 1;
+	// all timers share one scheduler event, armed for the first of them
+	uint32_t timerPulseEventId = 0;
+	int64_t timerPulseTime = 0;
+	uint64_t lastTimerPulse = 0;
+
 	uint32_t lastCombatId = 0;
 	uint32_t lastAreaId = 0;
 
+	lua_Alloc defaultAlloc = nullptr;
+	void* defaultAllocData = nullptr;
+
+	// keyed by script id, the names are only looked up when the stats are read
+	std::map<std::pair<LuaScriptInterface*, int32_t>, LuaAllocationStats> allocationStats;
+	// files being loaded, which all share one id, and scripts whose id went away
+	std::map<std::string, LuaAllocationStats, std::less<>> namedAllocationStats;
+	// the script that allocated last, most allocations come from the same script in a row
+	LuaAllocationStats* lastAllocationStats = nullptr;
+	LuaScriptInterface* lastAllocationInterface = nullptr;
+	int32_t lastAllocationScriptId = 0;
+
+	uint64_t allocatedBytes = 0;
+	uint64_t collectedUpToBytes = 0;
+	int32_t idleStepSize = 0;
+	bool incrementalGc = true;
+
 	friend class LuaScriptInterface;
 	friend class CombatSpell;
 };
@@ -537,6 +614,8 @@ void pushVariant(lua_State* L, const LuaVariant& var);
 void pushString(lua_State* L, std::string_view value);
 void pushCallback(lua_State* L, int32_t callback);
 void pushCylinder(lua_State* L, Cylinder* cylinder);
+// Pushes the creature with its Player, Monster or Npc metatable, reusing the userdata Lua still holds for its id.
+void pushCreature(lua_State* L, Creature* creature);
 
 std::string popString(lua_State* L);
 int32_t popCallback(lua_State* L);
@@ -548,6 +627,12 @@ void setWeakMetatable(lua_State* L, int32_t index, std::string_view name);
 void setItemMetatable(lua_State* L, int32_t index, const Item* item);
 void setCreatureMetatable(lua_State* L, int32_t index, const Creature* creature);
 
+// Userdata cache, weak valued: an entry lives as long as some script still references the userdata. The cached
+// userdata is only returned while it still points to value, so a stale entry is never handed out.
+bool pushCachedUserdata(lua_State* L, lua_Integer key, const void* value);
+// caches the userdata on top of the stack under key, leaving it on the stack
+void cacheUserdata(lua_State* L, lua_Integer key);
+
 // Get
 LuaVariant getVariant(lua_State* L, int32_t arg);
 
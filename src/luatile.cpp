@@ -92,8 +92,7 @@ int luaTileGetThing(lua_State* L)
 	}
 
 	if (Creature* creature = thing->getCreature()) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 	} else if (Item* item = thing->getItem()) {
 		pushUserdata<Item>(L, item);
 		setItemMetatable(L, -1, item);
@@ -132,8 +131,7 @@ int luaTileGetTopVisibleThing(lua_State* L)
 	}
 
 	if (Creature* visibleCreature = thing->getCreature()) {
-		pushUserdata<Creature>(L, visibleCreature);
-		setCreatureMetatable(L, -1, visibleCreature);
+		pushCreature(L, visibleCreature);
 	} else if (Item* visibleItem = thing->getItem()) {
 		pushUserdata<Item>(L, visibleItem);
 		setItemMetatable(L, -1, visibleItem);
@@ -379,8 +377,7 @@ int luaTileGetTopCreature(lua_State* L)
 		return 1;
 	}
 
-	pushUserdata<Creature>(L, creature);
-	setCreatureMetatable(L, -1, creature);
+	pushCreature(L, creature);
 	return 1;
 }
 
@@ -426,8 +423,7 @@ int luaTileGetTopVisibleCreature(lua_State* L)
 
 	Creature* visibleCreature = tile->getTopVisibleCreature(creature);
 	if (visibleCreature) {
-		pushUserdata<Creature>(L, visibleCreature);
-		setCreatureMetatable(L, -1, visibleCreature);
+		pushCreature(L, visibleCreature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -517,8 +513,7 @@ int luaTileGetCreatures(lua_State* L)
 
 	int index = 0;
 	for (Creature* creature : *creatureVector) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
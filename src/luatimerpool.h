@@ -0,0 +1,161 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#ifndef FS_LUATIMERPOOL_H
+#define FS_LUATIMERPOOL_H
+
+#include <queue>
+
+// Pending addEvent timers. Descriptors live in a pool of slots that is reused, so a slot keeps the memory of the
+// descriptor it held before (the parameter vector of a timer event, for example). An id is the slot index in the low
+// IndexBits and the slot generation above them: erasing is an index and a generation compare, and an id whose timer
+// fired or was stopped never matches again.
+//
+// Due times are kept in a min-heap, erased timers stay in it until they come up and are skipped then.
+template <typename T>
+class LuaTimerPool
+{
+	static constexpr uint32_t IndexBits = 20;
+	static constexpr uint64_t indexMask = (uint64_t{1} << IndexBits) - 1;
+
+	struct Slot
+	{
+		T value{};
+		// generations start at 1 so no id is 0
+		uint32_t generation = 1;
+		bool pending = false;
+	};
+
+	struct Due
+	{
+		int64_t time;
+		// ties fire in the order they were added
+		uint64_t sequence;
+		uint64_t id;
+
+		bool operator>(const Due& other) const
+		{
+			return time != other.time ? time > other.time : sequence > other.sequence;
+		}
+	};
+
+public:
+	// returns 0 if every slot is taken, otherwise the new id; value(id) is the descriptor to fill in, it still holds
+	// what the slot held before
+	uint64_t add(int64_t time)
+	{
+		uint32_t index;
+		if (!freeSlots.empty()) {
+			index = freeSlots.back();
+			freeSlots.pop_back();
+		} else if (slots.size() <= indexMask) {
+			index = static_cast<uint32_t>(slots.size());
+			slots.emplace_back();
+		} else {
+			return 0;
+		}
+
+		Slot& slot = slots[index];
+		slot.pending = true;
+		++count;
+
+		uint64_t id = (uint64_t{slot.generation} << IndexBits) | index;
+		dueTimes.push({time, ++lastSequence, id});
+		return id;
+	}
+
+	// nullptr unless id is pending, valid until the next add
+	T* find(uint64_t id)
+	{
+		Slot* slot = getSlot(id);
+		return slot ? &slot->value : nullptr;
+	}
+
+	// frees the slot, the descriptor is kept for reuse; returns false if id is not pending
+	bool erase(uint64_t id)
+	{
+		Slot* slot = getSlot(id);
+		if (!slot) {
+			return false;
+		}
+
+		slot->pending = false;
+		++slot->generation;
+		--count;
+		freeSlots.push_back(static_cast<uint32_t>(id & indexMask));
+		return true;
+	}
+
+	// id of the first timer due at or before now, 0 if there is none; the timer stays pending until it is erased
+	uint64_t nextDue(int64_t now)
+	{
+		skipErased();
+		if (dueTimes.empty() || dueTimes.top().time > now) {
+			return 0;
+		}
+
+		uint64_t id = dueTimes.top().id;
+		dueTimes.pop();
+		return id;
+	}
+
+	// due time of the first pending timer
+	std::optional<int64_t> nextDueTime()
+	{
+		skipErased();
+		if (dueTimes.empty()) {
+			return std::nullopt;
+		}
+		return dueTimes.top().time;
+	}
+
+	size_t size() const { return count; }
+
+	template <typename Func>
+	void forEach(Func&& func)
+	{
+		for (Slot& slot : slots) {
+			if (slot.pending) {
+				func(slot.value);
+			}
+		}
+	}
+
+	void clear()
+	{
+		slots.clear();
+		freeSlots.clear();
+		dueTimes = {};
+		count = 0;
+	}
+
+private:
+	Slot* getSlot(uint64_t id)
+	{
+		uint64_t index = id & indexMask;
+		if (index >= slots.size()) {
+			return nullptr;
+		}
+
+		Slot& slot = slots[index];
+		if (!slot.pending || slot.generation != (id >> IndexBits)) {
+			return nullptr;
+		}
+		return &slot;
+	}
+
+	void skipErased()
+	{
+		while (!dueTimes.empty() && !getSlot(dueTimes.top().id)) {
+			dueTimes.pop();
+		}
+	}
+
+	std::vector<Slot> slots;
+	std::vector<uint32_t> freeSlots;
+	std::priority_queue<Due, std::vector<Due>, std::greater<>> dueTimes;
+	uint64_t lastSequence = 0;
+	size_t count = 0;
+};
+
+#endif // FS_LUATIMERPOOL_H
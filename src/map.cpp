@@ -263,10 +263,15 @@ void Map::moveCreature(Creature& creature, Tile& newTile, bool forceTeleport /*
 
 	bool teleport = forceTeleport || !newTile.getGround() || !oldPos.isInRange(newPos, 1, 1, 0);
 
-	SpectatorVec spectators, newPosSpectators;
-	getSpectators(spectators, oldPos, true);
-	getSpectators(newPosSpectators, newPos, true);
-	spectators.addSpectators(newPosSpectators);
+	SpectatorVec spectators;
+	if (oldPos.z == newPos.z && oldPos.isInRange(newPos, 1, 1, 0)) {
+		getStepSpectators(spectators, oldPos, newPos);
+	} else {
+		SpectatorVec newPosSpectators;
+		getSpectators(spectators, oldPos, true);
+		getSpectators(newPosSpectators, newPos, true);
+		spectators.addSpectators(newPosSpectators);
+	}
 
 	std::vector<int32_t> oldStackPosVector;
 	for (Creature* spectator : spectators) {
@@ -482,6 +487,38 @@ void Map::getSpectators(SpectatorVec& spectators, const Position& centerPos, boo
 	}
 }
 
+void Map::getStepSpectators(SpectatorVec& spectators, const Position& oldPos, const Position& newPos)
+{
+	// both viewports may still be cached from earlier lookups. Nothing is stored here because moving the creature
+	// between tiles clears the cache right after
+	auto oldIt = spectatorCache.find(oldPos);
+	auto newIt = spectatorCache.find(newPos);
+	if (oldIt != spectatorCache.end() && newIt != spectatorCache.end()) {
+		spectators = oldIt->second;
+		spectators.addSpectators(newIt->second);
+		return;
+	}
+
+	// one scan of the sectors both viewports cover instead of two scans and a quadratic merge
+	getSpectators(spectators, oldPos, true, false, maxViewportX + std::max(0, oldPos.x - newPos.x),
+	              maxViewportX + std::max(0, newPos.x - oldPos.x), maxViewportY + std::max(0, oldPos.y - newPos.y),
+	              maxViewportY + std::max(0, newPos.y - oldPos.y));
+
+	// a diagonal step scans two corners neither viewport covers
+	if (oldPos.x != newPos.x && oldPos.y != newPos.y) {
+		auto inViewport = [](const Position& centerPos, const Position& pos) {
+			int16_t offsetZ = centerPos.getOffsetZ(pos);
+			return std::abs(pos.x - centerPos.x - offsetZ) <= maxViewportX &&
+			       std::abs(pos.y - centerPos.y - offsetZ) <= maxViewportY;
+		};
+
+		spectators.eraseIf([&](const Creature* spectator) {
+			const Position& pos = spectator->getPosition();
+			return !inViewport(oldPos, pos) && !inViewport(newPos, pos);
+		});
+	}
+}
+
 void Map::clearSpectatorCache() { spectatorCache.clear(); }
 
 void Map::clearPlayersSpectatorCache() { playersSpectatorCache.clear(); }
@@ -273,6 +273,8 @@ private:
 	void getSpectatorsInternal(SpectatorVec& spectators, const Position& centerPos, int32_t minRangeX,
 	                           int32_t maxRangeX, int32_t minRangeY, int32_t maxRangeY, int32_t minRangeZ,
 	                           int32_t maxRangeZ, bool onlyPlayers) const;
+	// Spectators of a single step on the same floor: everyone in the old or the new viewport, found in one scan
+	void getStepSpectators(SpectatorVec& spectators, const Position& oldPos, const Position& newPos);
 
 	friend class Game;
 	friend class IOMap;
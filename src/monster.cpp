@@ -18,8 +18,6 @@ extern Events* g_events;
 int32_t Monster::despawnRange;
 int32_t Monster::despawnRadius;
 
-uint32_t Monster::monsterAutoID = 0x40000000;
-
 Monster* Monster::createMonster(const std::string& name)
 {
 	MonsterType* mType = g_monsters.getMonsterType(name);
@@ -52,6 +50,17 @@ Monster::~Monster()
 {
 	clearTargetList();
 	clearFriendList();
+
+	if (id != 0) {
+		g_game.releaseMonsterId(id);
+	}
+}
+
+void Monster::setID()
+{
+	if (id == 0) {
+		id = g_game.reserveMonsterId();
+	}
 }
 
 void Monster::addList() { g_game.addMonster(this); }
@@ -126,11 +135,9 @@ void Monster::onCreatureAppear(Creature* creature, bool isLogin)
 		lua_State* L = scriptInterface->getLuaState();
 		scriptInterface->pushFunction(mType->info.creatureAppearEvent);
 
-		Lua::pushUserdata<Monster>(L, this);
-		Lua::setMetatable(L, -1, "Monster");
+		Lua::pushCreature(L, this);
 
-		Lua::pushUserdata<Creature>(L, creature);
-		Lua::setCreatureMetatable(L, -1, creature);
+		Lua::pushCreature(L, creature);
 
 		if (scriptInterface->callFunction(2)) {
 			return;
@@ -168,11 +175,9 @@ void Monster::onRemoveCreature(Creature* creature, bool isLogout)
 		lua_State* L = scriptInterface->getLuaState();
 		scriptInterface->pushFunction(mType->info.creatureDisappearEvent);
 
-		Lua::pushUserdata<Monster>(L, this);
-		Lua::setMetatable(L, -1, "Monster");
+		Lua::pushCreature(L, this);
 
-		Lua::pushUserdata<Creature>(L, creature);
-		Lua::setCreatureMetatable(L, -1, creature);
+		Lua::pushCreature(L, creature);
 
 		if (scriptInterface->callFunction(2)) {
 			return;
@@ -209,11 +214,9 @@ void Monster::onCreatureMove(Creature* creature, const Tile* newTile, const Posi
 		lua_State* L = scriptInterface->getLuaState();
 		scriptInterface->pushFunction(mType->info.creatureMoveEvent);
 
-		Lua::pushUserdata<Monster>(L, this);
-		Lua::setMetatable(L, -1, "Monster");
+		Lua::pushCreature(L, this);
 
-		Lua::pushUserdata<Creature>(L, creature);
-		Lua::setCreatureMetatable(L, -1, creature);
+		Lua::pushCreature(L, creature);
 
 		Lua::pushPosition(L, oldPos);
 		Lua::pushPosition(L, newPos);
@@ -291,11 +294,9 @@ void Monster::onCreatureSay(Creature* creature, SpeakClasses type, std::string_v
 		lua_State* L = scriptInterface->getLuaState();
 		scriptInterface->pushFunction(mType->info.creatureSayEvent);
 
-		Lua::pushUserdata<Monster>(L, this);
-		Lua::setMetatable(L, -1, "Monster");
+		Lua::pushCreature(L, this);
 
-		Lua::pushUserdata<Creature>(L, creature);
-		Lua::setCreatureMetatable(L, -1, creature);
+		Lua::pushCreature(L, creature);
 
 		lua_pushinteger(L, type);
 		Lua::pushString(L, text);
@@ -775,8 +776,7 @@ void Monster::onThink(uint32_t interval)
 		lua_State* L = scriptInterface->getLuaState();
 		scriptInterface->pushFunction(mType->info.thinkEvent);
 
-		Lua::pushUserdata<Monster>(L, this);
-		Lua::setMetatable(L, -1, "Monster");
+		Lua::pushCreature(L, this);
 
 		lua_pushinteger(L, interval);
 
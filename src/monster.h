@@ -41,12 +41,7 @@ public:
 	Monster* getMonster() override { return this; }
 	const Monster* getMonster() const override { return this; }
 
-	void setID() override
-	{
-		if (id == 0) {
-			id = monsterAutoID++;
-		}
-	}
+	void setID() override;
 
 	void addList() override;
 	void removeList() override;
@@ -127,8 +122,6 @@ public:
 	BlockType_t blockHit(Creature* attacker, CombatType_t combatType, int32_t& damage, bool checkDefense = false,
 	                     bool checkArmor = false, bool field = false, bool ignoreResistances = false) override;
 
-	static uint32_t monsterAutoID;
-
 	// for lua module
 	auto getMonsterType() const { return mType; }
 
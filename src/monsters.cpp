@@ -40,8 +40,13 @@ void MonsterType::loadLoot(MonsterType* monsterType, LootBlock lootBlock)
 	}
 }
 
+Monsters::~Monsters() { stopPreload(); }
+
 bool Monsters::loadFromXml(bool reloading /*= false*/)
 {
+	stopPreload();
+	++preloadGeneration;
+
 	unloadedMonsters = {};
 	pugi::xml_document doc;
 	pugi::xml_parse_result result = doc.load_file("data/monster/monsters.xml");
@@ -60,12 +65,48 @@ bool Monsters::loadFromXml(bool reloading /*= false*/)
 
 	bool forceLoad = getBoolean(ConfigManager::FORCE_MONSTERTYPE_LOAD);
 
+	std::vector<std::pair<std::string, std::string>> files;
 	for (const auto& [monsterName, file] : unloadedMonsters) {
 		if (forceLoad || (reloading && monsters.find(monsterName) != monsters.end())) {
-			loadMonster(file, monsterName, reloading);
+			files.emplace_back(monsterName, file);
 		}
 	}
 
+	// parse every file on all hardware threads, then report errors and build the monster types in file order
+	std::vector<std::unique_ptr<pugi::xml_document>> docs(files.size());
+	std::vector<pugi::xml_parse_result> results(files.size());
+	std::atomic<size_t> nextFile{0};
+	size_t threads = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), files.size()));
+	std::vector<std::thread> workers(threads);
+	for (auto& worker : workers) {
+		worker = std::thread([&]() {
+			for (size_t i = nextFile++; i < files.size(); i = nextFile++) {
+				docs[i] = parseMonsterFile(files[i].second, results[i]);
+			}
+		});
+	}
+	for (auto& worker : workers) {
+		worker.join();
+	}
+
+	for (size_t i = 0; i < files.size(); ++i) {
+		if (docs[i]) {
+			loadMonster(*docs[i], files[i].second, files[i].first, reloading);
+		} else {
+			printXMLError("Error - Monsters::loadMonster", files[i].second, results[i]);
+		}
+	}
+
+	if (!forceLoad && getBoolean(ConfigManager::PRELOAD_MONSTERTYPES)) {
+		std::vector<std::pair<std::string, std::string>> pending;
+		for (const auto& [monsterName, file] : unloadedMonsters) {
+			if (monsters.find(monsterName) == monsters.end()) {
+				pending.emplace_back(monsterName, file);
+			}
+		}
+		startPreload(std::move(pending));
+	}
+
 	return true;
 }
 
@@ -78,6 +119,53 @@ bool Monsters::reload()
 	return loadFromXml(true);
 }
 
+void Monsters::startPreload(std::vector<std::pair<std::string, std::string>> files)
+{
+	preloadStopped = false;
+	preloadThread = std::thread([this, files = std::move(files), generation = preloadGeneration]() {
+		for (const auto& [monsterName, file] : files) {
+			// the shutdown joins this thread before it stops the dispatcher, so every task posted here can still run
+			if (preloadStopped) {
+				return;
+			}
+
+			pugi::xml_parse_result result;
+			std::shared_ptr<pugi::xml_document> doc = parseMonsterFile(file, result);
+			if (!doc) {
+				g_dispatcher.addTask(
+				    [file, result]() { printXMLError("Error - Monsters::loadMonster", file, result); });
+				continue;
+			}
+
+			// one task per monster type keeps each dispatcher slice short
+			g_dispatcher.addTask([this, doc, monsterName, file, generation]() {
+				if (generation == preloadGeneration && monsters.find(monsterName) == monsters.end()) {
+					loadMonster(*doc, file, monsterName, false);
+				}
+			});
+		}
+	});
+}
+
+void Monsters::stopPreload()
+{
+	preloadStopped = true;
+	if (preloadThread.joinable()) {
+		preloadThread.join();
+	}
+}
+
+std::unique_ptr<pugi::xml_document> Monsters::parseMonsterFile(const std::string& file,
+                                                               pugi::xml_parse_result& result)
+{
+	auto doc = std::make_unique<pugi::xml_document>();
+	result = doc->load_file(file.c_str());
+	if (!result) {
+		return nullptr;
+	}
+	return doc;
+}
+
 ConditionDamage* Monsters::getDamageCondition(ConditionType_t conditionType, int32_t maxDamage, int32_t minDamage,
                                               int32_t startDamage, uint32_t tickInterval)
 {
@@ -790,14 +878,19 @@ bool Monsters::deserializeSpell(MonsterSpell* spell, spellBlock_t& sb, const std
 
 MonsterType* Monsters::loadMonster(const std::string& file, const std::string& monsterName, bool reloading /*= false*/)
 {
-	MonsterType* mType = nullptr;
-
-	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(file.c_str());
-	if (!result) {
+	pugi::xml_parse_result result;
+	auto doc = parseMonsterFile(file, result);
+	if (!doc) {
 		printXMLError("Error - Monsters::loadMonster", file, result);
 		return nullptr;
 	}
+	return loadMonster(*doc, file, monsterName, reloading);
+}
+
+MonsterType* Monsters::loadMonster(const pugi::xml_document& doc, const std::string& file,
+                                   const std::string& monsterName, bool reloading)
+{
+	MonsterType* mType = nullptr;
 
 	pugi::xml_node monsterNode = doc.child("monster");
 	if (!monsterNode) {
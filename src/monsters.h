@@ -230,6 +230,8 @@ class Monsters
 {
 public:
 	Monsters() = default;
+	~Monsters();
+
 	// non-copyable
 	Monsters(const Monsters&) = delete;
 	Monsters& operator=(const Monsters&) = delete;
@@ -242,6 +244,8 @@ public:
 	MonsterType* getMonsterType(uint32_t raceId);
 	bool deserializeSpell(MonsterSpell* spell, spellBlock_t& sb, const std::string& description = "");
 	bool registerBestiaryMonster(const MonsterType* mType);
+	// waits for the background preload to stop, the shutdown calls it before stopping the dispatcher
+	void stopPreload();
 
 	std::unique_ptr<LuaScriptInterface> scriptInterface;
 	std::map<std::string, MonsterType> monsters;
@@ -252,6 +256,14 @@ private:
 	bool deserializeSpell(const pugi::xml_node& node, spellBlock_t& sb, const std::string& description = "");
 
 	MonsterType* loadMonster(const std::string& file, const std::string& monsterName, bool reloading = false);
+	MonsterType* loadMonster(const pugi::xml_document& doc, const std::string& file, const std::string& monsterName,
+	                         bool reloading);
+
+	// Monster files are parsed off the dispatcher, only building the MonsterType (spells, scripts, conditions) and
+	// printing parse errors has to run on it. parseMonsterFile is safe to call from any thread.
+	static std::unique_ptr<pugi::xml_document> parseMonsterFile(const std::string& file,
+	                                                            pugi::xml_parse_result& result);
+	void startPreload(std::vector<std::pair<std::string, std::string>> files);
 
 	void loadLootContainer(const pugi::xml_node& node, LootBlock&);
 	bool loadLootItem(const pugi::xml_node& node, LootBlock&);
@@ -259,6 +271,11 @@ private:
 	std::map<std::string, std::string> unloadedMonsters;
 	std::unordered_map<uint32_t, std::string> bestiaryMonsters;
 
+	std::thread preloadThread;
+	std::atomic<bool> preloadStopped{false};
+	// bumped on every (re)load, preloaded files queued for an older one are dropped
+	uint32_t preloadGeneration = 0;
+
 	bool loaded = false;
 };
 
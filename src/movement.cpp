@@ -15,43 +15,71 @@ MoveEvents::MoveEvents() : scriptInterface("MoveEvents Interface") { scriptInter
 
 MoveEvents::~MoveEvents() { clear(false); }
 
-void MoveEvents::clearMap(MoveListMap& map, bool fromLua)
+static void clearMoveEventList(MoveEventList& moveEventList, bool fromLua)
 {
-	for (auto it = map.begin(); it != map.end(); ++it) {
-		for (int eventType = MOVE_EVENT_STEP_IN; eventType < MOVE_EVENT_LAST; ++eventType) {
-			auto& moveEvents = it->second.moveEvent[eventType];
-			for (auto find = moveEvents.begin(); find != moveEvents.end();) {
-				if (fromLua == find->fromLua) {
-					find = moveEvents.erase(find);
-				} else {
-					++find;
-				}
-			}
+	for (auto& moveEvents : moveEventList.moveEvent) {
+		moveEvents.remove_if([fromLua](const MoveEvent& moveEvent) { return fromLua == moveEvent.fromLua; });
+	}
+}
+
+static bool isMoveEventListEmpty(const MoveEventList& moveEventList)
+{
+	return std::all_of(std::begin(moveEventList.moveEvent), std::end(moveEventList.moveEvent),
+	                   [](const std::list<MoveEvent>& moveEvents) { return moveEvents.empty(); });
+}
+
+MoveEventList& MoveEvents::MoveListMap::operator[](uint16_t id)
+{
+	MoveEventList* moveEventList = index.get(id);
+	if (!moveEventList) {
+		moveEventList = &lists[id];
+		index.set(id, moveEventList);
+		if (itemScriptEvent != 0) {
+			Item::items.setScriptEvent(id, static_cast<ItemScriptEvents_t>(itemScriptEvent));
 		}
 	}
+	return *moveEventList;
+}
+
+void MoveEvents::MoveListMap::clear(bool fromLua)
+{
+	index.clear();
+	if (itemScriptEvent != 0) {
+		Item::items.resetScriptEvents(static_cast<ItemScriptEvents_t>(itemScriptEvent));
+	}
+
+	for (auto it = lists.begin(); it != lists.end();) {
+		clearMoveEventList(it->second, fromLua);
+		if (isMoveEventListEmpty(it->second)) {
+			it = lists.erase(it);
+			continue;
+		}
+
+		index.set(it->first, &it->second);
+		if (itemScriptEvent != 0) {
+			Item::items.setScriptEvent(it->first, static_cast<ItemScriptEvents_t>(itemScriptEvent));
+		}
+		++it;
+	}
 }
 
 void MoveEvents::clearPosMap(MovePosListMap& map, bool fromLua)
 {
-	for (auto it = map.begin(); it != map.end(); ++it) {
-		for (int eventType = MOVE_EVENT_STEP_IN; eventType < MOVE_EVENT_LAST; ++eventType) {
-			auto& moveEvents = it->second.moveEvent[eventType];
-			for (auto find = moveEvents.begin(); find != moveEvents.end();) {
-				if (fromLua == find->fromLua) {
-					find = moveEvents.erase(find);
-				} else {
-					++find;
-				}
-			}
+	for (auto it = map.begin(); it != map.end();) {
+		clearMoveEventList(it->second, fromLua);
+		if (isMoveEventListEmpty(it->second)) {
+			it = map.erase(it);
+		} else {
+			++it;
 		}
 	}
 }
 
 void MoveEvents::clear(bool fromLua)
 {
-	clearMap(itemIdMap, fromLua);
-	clearMap(actionIdMap, fromLua);
-	clearMap(uniqueIdMap, fromLua);
+	itemIdMap.clear(fromLua);
+	actionIdMap.clear(fromLua);
+	uniqueIdMap.clear(fromLua);
 	clearPosMap(positionMap, fromLua);
 
 	reInitState(fromLua);
@@ -280,20 +308,13 @@ bool MoveEvents::registerLuaEvent(MoveEvent* event)
 
 void MoveEvents::addEvent(MoveEvent moveEvent, uint16_t id, MoveListMap& map)
 {
-	auto it = map.find(id);
-	if (it == map.end()) {
-		MoveEventList moveEventList;
-		moveEventList.moveEvent[moveEvent.getEventType()].push_back(std::move(moveEvent));
-		map[id] = moveEventList;
-	} else {
-		std::list<MoveEvent>& moveEventList = it->second.moveEvent[moveEvent.getEventType()];
-		for (MoveEvent& existingMoveEvent : moveEventList) {
-			if (existingMoveEvent.getSlot() == moveEvent.getSlot()) {
-				std::cout << "[Warning - MoveEvents::addEvent] Duplicate move event found: " << id << std::endl;
-			}
+	std::list<MoveEvent>& moveEventList = map[id].moveEvent[moveEvent.getEventType()];
+	for (MoveEvent& existingMoveEvent : moveEventList) {
+		if (existingMoveEvent.getSlot() == moveEvent.getSlot()) {
+			std::cout << "[Warning - MoveEvents::addEvent] Duplicate move event found: " << id << std::endl;
 		}
-		moveEventList.push_back(std::move(moveEvent));
 	}
+	moveEventList.push_back(std::move(moveEvent));
 }
 
 MoveEvent* MoveEvents::getEvent(Item* item, MoveEvent_t eventType, slots_t slot)
@@ -335,10 +356,12 @@ MoveEvent* MoveEvents::getEvent(Item* item, MoveEvent_t eventType, slots_t slot)
 			break;
 	}
 
-	auto it = itemIdMap.find(item->getID());
-	if (it != itemIdMap.end()) {
-		std::list<MoveEvent>& moveEventList = it->second.moveEvent[eventType];
-		for (MoveEvent& moveEvent : moveEventList) {
+	if (!Item::items[item->getID()].hasScriptEvent(ITEM_SCRIPT_MOVEEVENT)) {
+		return nullptr;
+	}
+
+	if (MoveEventList* moveEventList = itemIdMap.find(item->getID())) {
+		for (MoveEvent& moveEvent : moveEventList->moveEvent[eventType]) {
 			if ((moveEvent.getSlot() & slotp) != 0) {
 				return &moveEvent;
 			}
@@ -349,33 +372,32 @@ MoveEvent* MoveEvents::getEvent(Item* item, MoveEvent_t eventType, slots_t slot)
 
 MoveEvent* MoveEvents::getEvent(Item* item, MoveEvent_t eventType)
 {
-	MoveListMap::iterator it;
-
 	if (item->hasAttribute(ITEM_ATTRIBUTE_UNIQUEID)) {
-		it = uniqueIdMap.find(item->getUniqueId());
-		if (it != uniqueIdMap.end()) {
-			std::list<MoveEvent>& moveEventList = it->second.moveEvent[eventType];
-			if (!moveEventList.empty()) {
-				return &(*moveEventList.begin());
+		if (MoveEventList* moveEventList = uniqueIdMap.find(item->getUniqueId())) {
+			std::list<MoveEvent>& moveEvents = moveEventList->moveEvent[eventType];
+			if (!moveEvents.empty()) {
+				return &moveEvents.front();
 			}
 		}
 	}
 
 	if (item->hasAttribute(ITEM_ATTRIBUTE_ACTIONID)) {
-		it = actionIdMap.find(item->getActionId());
-		if (it != actionIdMap.end()) {
-			std::list<MoveEvent>& moveEventList = it->second.moveEvent[eventType];
-			if (!moveEventList.empty()) {
-				return &(*moveEventList.begin());
+		if (MoveEventList* moveEventList = actionIdMap.find(item->getActionId())) {
+			std::list<MoveEvent>& moveEvents = moveEventList->moveEvent[eventType];
+			if (!moveEvents.empty()) {
+				return &moveEvents.front();
 			}
 		}
 	}
 
-	it = itemIdMap.find(item->getID());
-	if (it != itemIdMap.end()) {
-		std::list<MoveEvent>& moveEventList = it->second.moveEvent[eventType];
-		if (!moveEventList.empty()) {
-			return &(*moveEventList.begin());
+	if (!Item::items[item->getID()].hasScriptEvent(ITEM_SCRIPT_MOVEEVENT)) {
+		return nullptr;
+	}
+
+	if (MoveEventList* moveEventList = itemIdMap.find(item->getID())) {
+		std::list<MoveEvent>& moveEvents = moveEventList->moveEvent[eventType];
+		if (!moveEvents.empty()) {
+			return &moveEvents.front();
 		}
 	}
 	return nullptr;
@@ -383,23 +405,20 @@ MoveEvent* MoveEvents::getEvent(Item* item, MoveEvent_t eventType)
 
 void MoveEvents::addEvent(MoveEvent moveEvent, const Position& pos, MovePosListMap& map)
 {
-	auto it = map.find(pos);
-	if (it == map.end()) {
-		MoveEventList moveEventList;
-		moveEventList.moveEvent[moveEvent.getEventType()].push_back(std::move(moveEvent));
-		map[pos] = moveEventList;
-	} else {
-		std::list<MoveEvent>& moveEventList = it->second.moveEvent[moveEvent.getEventType()];
-		if (!moveEventList.empty()) {
-			std::cout << "[Warning - MoveEvents::addEvent] Duplicate move event found: " << pos << std::endl;
-		}
-
-		moveEventList.push_back(std::move(moveEvent));
+	std::list<MoveEvent>& moveEventList = map[pos].moveEvent[moveEvent.getEventType()];
+	if (!moveEventList.empty()) {
+		std::cout << "[Warning - MoveEvents::addEvent] Duplicate move event found: " << pos << std::endl;
 	}
+
+	moveEventList.push_back(std::move(moveEvent));
 }
 
 MoveEvent* MoveEvents::getEvent(const Tile* tile, MoveEvent_t eventType)
 {
+	if (positionMap.empty()) {
+		return nullptr;
+	}
+
 	auto it = positionMap.find(tile->getPosition());
 	if (it != positionMap.end()) {
 		std::list<MoveEvent>& moveEventList = it->second.moveEvent[eventType];
@@ -995,8 +1014,7 @@ bool MoveEvent::executeStep(Creature* creature, Item* item, const Position& pos)
 	lua_State* L = scriptInterface->getLuaState();
 
 	scriptInterface->pushFunction(scriptId);
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 	Lua::pushThing(L, item);
 	Lua::pushPosition(L, pos);
 	Lua::pushPosition(L, creature->getLastPosition());
@@ -1033,8 +1051,7 @@ bool MoveEvent::executeEquip(Player* player, Item* item, slots_t slot, bool isCh
 	lua_State* L = scriptInterface->getLuaState();
 
 	scriptInterface->pushFunction(scriptId);
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 	Lua::pushThing(L, item);
 	lua_pushinteger(L, slot);
 	Lua::pushBoolean(L, isCheck);
@@ -6,6 +6,7 @@
 
 #include "baseevents.h"
 #include "creature.h"
+#include "idtable.h"
 #include "item.h"
 #include "luascript.h"
 #include "vocation.h"
@@ -57,9 +58,23 @@ public:
 	void clear(bool fromLua) override final;
 
 private:
-	using MoveListMap = std::map<uint16_t, MoveEventList>;
-	using MovePosListMap = std::map<Position, MoveEventList>;
-	void clearMap(MoveListMap& map, bool fromLua);
+	// owns the registered events, lookups go through the flat id table
+	class MoveListMap
+	{
+	public:
+		explicit MoveListMap(uint8_t itemScriptEvent = 0) : itemScriptEvent{itemScriptEvent} {}
+
+		MoveEventList& operator[](uint16_t id);
+		MoveEventList* find(uint16_t id) const { return index.get(id); }
+		void clear(bool fromLua);
+
+	private:
+		std::map<uint16_t, MoveEventList> lists;
+		IdTable<MoveEventList> index;
+		uint8_t itemScriptEvent;
+	};
+
+	using MovePosListMap = std::unordered_map<Position, MoveEventList>;
 	void clearPosMap(MovePosListMap& map, bool fromLua);
 
 	LuaScriptInterface& getScriptInterface() override;
@@ -76,7 +91,7 @@ private:
 
 	MoveListMap uniqueIdMap;
 	MoveListMap actionIdMap;
-	MoveListMap itemIdMap;
+	MoveListMap itemIdMap{ITEM_SCRIPT_MOVEEVENT};
 	MovePosListMap positionMap;
 
 	LuaScriptInterface scriptInterface;
@@ -11,20 +11,69 @@
 extern Game g_game;
 extern LuaEnvironment g_luaEnvironment;
 
-uint32_t Npc::npcAutoID = 0x80000000;
+namespace {
 
-void Npcs::reload()
+std::shared_ptr<NpcScriptInterface> npcScriptInterface;
+NpcLoadStats npcLoadStats;
+
+int64_t getLuaMemory(lua_State* L) { return int64_t{lua_gc(L, LUA_GCCOUNT, 0)} * 1024 + lua_gc(L, LUA_GCCOUNTB, 0); }
+
+// adds the time and the Lua memory taken since it was constructed to the load stats
+class NpcLoadTimer
 {
-	const std::map<uint32_t, Npc*>& npcs = g_game.getNpcs();
-	for (const auto& it : npcs) {
-		it.second->closeAllShopWindows();
+public:
+	explicit NpcLoadTimer(lua_State* L) : L(L), start(std::chrono::steady_clock::now()), memory(getLuaMemory(L)) {}
+	~NpcLoadTimer()
+	{
+		npcLoadStats.time += std::chrono::steady_clock::now() - start;
+		npcLoadStats.memory += getLuaMemory(L) - memory;
 	}
 
-	for (const auto& it : npcs) {
-		it.second->reload();
+	// non-copyable
+	NpcLoadTimer(const NpcLoadTimer&) = delete;
+	NpcLoadTimer& operator=(const NpcLoadTimer&) = delete;
+
+private:
+	lua_State* L;
+	std::chrono::steady_clock::time_point start;
+	int64_t memory;
+};
+
+} // namespace
+
+void Npcs::reload()
+{
+	const NpcRegistry& npcs = g_game.getNpcs();
+	npcs.forEach([](Npc* npc) { npc->closeAllShopWindows(); });
+
+	// the npc lib is loaded again, by the first npc that needs it
+	npcScriptInterface.reset();
+	npcLoadStats = {};
+	npcs.forEach([](Npc* npc) { npc->reload(); });
+
+	const NpcLoadStats& stats = getLoadStats();
+	std::cout << ">> Reloaded " << stats.scripts << " npc scripts in "
+	          << std::chrono::duration_cast<std::chrono::milliseconds>(stats.time).count() << " ms, "
+	          << stats.memory / 1024 << " KB of Lua memory (" << stats.memory / std::max<int64_t>(stats.scripts, 1)
+	          << " bytes per npc)" << std::endl;
+}
+
+std::shared_ptr<NpcScriptInterface> Npcs::getScriptInterface()
+{
+	if (!npcScriptInterface) {
+		auto scriptInterface = std::make_shared<NpcScriptInterface>();
+		NpcLoadTimer timer{g_luaEnvironment.getLuaState()};
+		if (!scriptInterface->loadNpcLib("data/npc/lib/npc.lua")) {
+			std::cout << scriptInterface->getLastLuaError() << std::endl;
+			return nullptr;
+		}
+		npcScriptInterface = std::move(scriptInterface);
 	}
+	return npcScriptInterface;
 }
 
+const NpcLoadStats& Npcs::getLoadStats() { return npcLoadStats; }
+
 Npc* Npc::createNpc(const std::string& name)
 {
 	std::unique_ptr<Npc> npc(new Npc(name));
@@ -39,7 +88,21 @@ Npc::Npc(const std::string& name) : Creature(), filename("data/npc/" + name + ".
 	reset();
 }
 
-Npc::~Npc() { reset(); }
+Npc::~Npc()
+{
+	reset();
+
+	if (id != 0) {
+		g_game.releaseNpcId(id);
+	}
+}
+
+void Npc::setID()
+{
+	if (id == 0) {
+		id = g_game.reserveNpcId();
+	}
+}
 
 void Npc::addList() { g_game.addNpc(this); }
 
@@ -552,6 +615,52 @@ bool NpcScriptInterface::loadNpcLib(std::string_view file)
 	return true;
 }
 
+int32_t NpcScriptInterface::loadScript(std::string_view file, Npc* npc)
+{
+	// setmetatable({}, {__index = _G})
+	lua_newtable(luaState);
+	lua_createtable(luaState, 0, 1);
+#if defined(LUAJIT_VERSION)
+	lua_pushvalue(luaState, LUA_GLOBALSINDEX);
+#else
+	lua_rawgeti(luaState, LUA_REGISTRYINDEX, LUA_RIDX_GLOBALS);
+#endif
+	lua_setfield(luaState, -2, "__index");
+	lua_setmetatable(luaState, -2);
+	int32_t environmentRef = luaL_ref(luaState, LUA_REGISTRYINDEX);
+
+	if (loadFile(file, npc, environmentRef) == -1) {
+		luaL_unref(luaState, LUA_REGISTRYINDEX, environmentRef);
+		return -1;
+	}
+	return environmentRef;
+}
+
+int32_t NpcScriptInterface::getEnvironmentEvent(int32_t environmentRef, std::string_view eventName)
+{
+	// get our events table
+	lua_rawgeti(luaState, LUA_REGISTRYINDEX, eventTableRef);
+	if (!Lua::isTable(luaState, -1)) {
+		lua_pop(luaState, 1);
+		return -1;
+	}
+
+	// get the event function of the script
+	lua_rawgeti(luaState, LUA_REGISTRYINDEX, environmentRef);
+	lua_getfield(luaState, -1, eventName.data());
+	if (!Lua::isFunction(luaState, -1)) {
+		lua_pop(luaState, 3);
+		return -1;
+	}
+
+	// save in our events table
+	lua_rawseti(luaState, -3, runningEventId);
+	lua_pop(luaState, 2);
+
+	cacheFiles[runningEventId] = fmt::format("{}:{}", getFileById(EVENT_ID_LOADING), eventName);
+	return runningEventId++;
+}
+
 void NpcScriptInterface::registerFunctions()
 {
 	// npc exclusive functions
@@ -1048,26 +1157,46 @@ int NpcScriptInterface::luaNpcCloseShopWindow(lua_State* L)
 }
 
 NpcEventsHandler::NpcEventsHandler(const std::string& file, Npc* npc) :
-    scriptInterface(std::make_unique<NpcScriptInterface>()), npc(npc)
+    scriptInterface(Npcs::getScriptInterface()), npc(npc)
 {
-	if (!scriptInterface->loadNpcLib("data/npc/lib/npc.lua")) {
+	if (!scriptInterface) {
 		std::cout << "[Warning - NpcLib::NpcLib] Can not load lib: " << file << std::endl;
-		std::cout << scriptInterface->getLastLuaError() << std::endl;
 		return;
 	}
 
-	loaded = scriptInterface->loadFile("data/npc/scripts/" + file, npc) == 0;
+	NpcLoadTimer timer{scriptInterface->getLuaState()};
+	++npcLoadStats.scripts;
+
+	environmentRef = scriptInterface->loadScript("data/npc/scripts/" + file, npc);
+	loaded = environmentRef != -1;
 	if (!loaded) {
 		std::cout << "[Warning - NpcScript::NpcScript] Can not load script: " << file << std::endl;
 		std::cout << scriptInterface->getLastLuaError() << std::endl;
 	} else {
-		creatureSayEvent = scriptInterface->getEvent("onCreatureSay");
-		creatureDisappearEvent = scriptInterface->getEvent("onCreatureDisappear");
-		creatureAppearEvent = scriptInterface->getEvent("onCreatureAppear");
-		creatureMoveEvent = scriptInterface->getEvent("onCreatureMove");
-		playerCloseChannelEvent = scriptInterface->getEvent("onPlayerCloseChannel");
-		playerEndTradeEvent = scriptInterface->getEvent("onPlayerEndTrade");
-		thinkEvent = scriptInterface->getEvent("onThink");
+		creatureSayEvent = scriptInterface->getEnvironmentEvent(environmentRef, "onCreatureSay");
+		creatureDisappearEvent = scriptInterface->getEnvironmentEvent(environmentRef, "onCreatureDisappear");
+		creatureAppearEvent = scriptInterface->getEnvironmentEvent(environmentRef, "onCreatureAppear");
+		creatureMoveEvent = scriptInterface->getEnvironmentEvent(environmentRef, "onCreatureMove");
+		playerCloseChannelEvent = scriptInterface->getEnvironmentEvent(environmentRef, "onPlayerCloseChannel");
+		playerEndTradeEvent = scriptInterface->getEnvironmentEvent(environmentRef, "onPlayerEndTrade");
+		thinkEvent = scriptInterface->getEnvironmentEvent(environmentRef, "onThink");
+	}
+}
+
+NpcEventsHandler::~NpcEventsHandler()
+{
+	// the Lua state is closed already when the server shuts down
+	if (!scriptInterface || !g_luaEnvironment.getLuaState()) {
+		return;
+	}
+
+	for (int32_t event : {creatureAppearEvent, creatureDisappearEvent, creatureMoveEvent, creatureSayEvent,
+	                      playerCloseChannelEvent, playerEndTradeEvent, thinkEvent}) {
+		scriptInterface->removeEvent(event);
+	}
+
+	if (environmentRef != -1) {
+		luaL_unref(scriptInterface->getLuaState(), LUA_REGISTRYINDEX, environmentRef);
 	}
 }
 
@@ -1091,8 +1220,7 @@ void NpcEventsHandler::onCreatureAppear(Creature* creature) const
 
 	lua_State* L = scriptInterface->getLuaState();
 	scriptInterface->pushFunction(creatureAppearEvent);
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 	scriptInterface->callVoidFunction(1);
 }
 
@@ -1114,8 +1242,7 @@ void NpcEventsHandler::onCreatureDisappear(Creature* creature) const
 
 	lua_State* L = scriptInterface->getLuaState();
 	scriptInterface->pushFunction(creatureDisappearEvent);
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 	scriptInterface->callVoidFunction(1);
 }
 
@@ -1137,8 +1264,7 @@ void NpcEventsHandler::onCreatureMove(Creature* creature, const Position& oldPos
 
 	lua_State* L = scriptInterface->getLuaState();
 	scriptInterface->pushFunction(creatureMoveEvent);
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 	Lua::pushPosition(L, oldPos);
 	Lua::pushPosition(L, newPos);
 	scriptInterface->callVoidFunction(3);
@@ -1162,8 +1288,7 @@ void NpcEventsHandler::onCreatureSay(Creature* creature, SpeakClasses type, std:
 
 	lua_State* L = scriptInterface->getLuaState();
 	scriptInterface->pushFunction(creatureSayEvent);
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 	lua_pushinteger(L, type);
 	Lua::pushString(L, text);
 	scriptInterface->callVoidFunction(3);
@@ -1188,8 +1313,7 @@ void NpcEventsHandler::onPlayerTrade(Player* player, int32_t callback, uint16_t
 
 	lua_State* L = scriptInterface->getLuaState();
 	Lua::pushCallback(L, callback);
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 	lua_pushinteger(L, itemId);
 	lua_pushinteger(L, count);
 	lua_pushinteger(L, amount);
@@ -1216,8 +1340,7 @@ void NpcEventsHandler::onPlayerCloseChannel(Player* player) const
 
 	lua_State* L = scriptInterface->getLuaState();
 	scriptInterface->pushFunction(playerCloseChannelEvent);
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 	scriptInterface->callVoidFunction(1);
 }
 
@@ -1239,8 +1362,7 @@ void NpcEventsHandler::onPlayerEndTrade(Player* player) const
 
 	lua_State* L = scriptInterface->getLuaState();
 	scriptInterface->pushFunction(playerEndTradeEvent);
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 	scriptInterface->callVoidFunction(1);
 }
 
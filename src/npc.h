@@ -10,12 +10,26 @@
 #include <set>
 
 class Npc;
+class NpcScriptInterface;
 class Player;
 
+// npc scripts loaded since the server started, with the time their loading took and the Lua memory it added
+struct NpcLoadStats
+{
+	size_t scripts = 0;
+	int64_t memory = 0;
+	std::chrono::steady_clock::duration time{};
+};
+
 class Npcs
 {
 public:
 	static void reload();
+
+	// the interface every npc script runs in, created with the npc lib when it is first needed; nullptr if the lib
+	// does not load. A reload creates a new one, npcs loaded before keep the one they were loaded with.
+	static std::shared_ptr<NpcScriptInterface> getScriptInterface();
+	static const NpcLoadStats& getLoadStats();
 };
 
 class NpcScriptInterface final : public LuaScriptInterface
@@ -25,6 +39,13 @@ public:
 
 	bool loadNpcLib(std::string_view file);
 
+	// runs an npc script in an environment of its own, so the globals of one npc (its event functions) do not replace
+	// those of another; globals it does not define are read from the global table. Returns a registry reference to
+	// the environment, -1 if the script does not load.
+	int32_t loadScript(std::string_view file, Npc* npc);
+	// getEvent for a function defined in the environment of an npc script
+	int32_t getEnvironmentEvent(int32_t environmentRef, std::string_view eventName);
+
 private:
 	void registerFunctions();
 
@@ -59,6 +80,11 @@ class NpcEventsHandler
 {
 public:
 	NpcEventsHandler(const std::string& file, Npc* npc);
+	~NpcEventsHandler();
+
+	// non-copyable
+	NpcEventsHandler(const NpcEventsHandler&) = delete;
+	NpcEventsHandler& operator=(const NpcEventsHandler&) = delete;
 
 	void onCreatureAppear(Creature* creature) const;
 	void onCreatureDisappear(Creature* creature) const;
@@ -72,11 +98,13 @@ public:
 
 	bool isLoaded() const;
 
-	std::unique_ptr<NpcScriptInterface> scriptInterface;
+	std::shared_ptr<NpcScriptInterface> scriptInterface;
 
 private:
 	Npc* npc;
 
+	int32_t environmentRef = -1;
+
 	int32_t creatureAppearEvent = -1;
 	int32_t creatureDisappearEvent = -1;
 	int32_t creatureMoveEvent = -1;
@@ -103,12 +131,7 @@ public:
 
 	bool isPushable() const override { return pushable && walkTicks != 0; }
 
-	void setID() override
-	{
-		if (id == 0) {
-			id = npcAutoID++;
-		}
-	}
+	void setID() override;
 
 	void removeList() override;
 	void addList() override;
@@ -153,8 +176,6 @@ public:
 
 	auto& getScriptInterface() { return npcEventHandler->scriptInterface; }
 
-	static uint32_t npcAutoID;
-
 private:
 	explicit Npc(const std::string& name);
 
@@ -10,6 +10,7 @@
 #include "databasetasks.h"
 #include "game.h"
 #include "logger.h"
+#include "npc.h"
 #include "protocollogin.h"
 #include "protocolold.h"
 #include "protocolstatus.h"
@@ -34,6 +35,7 @@ Game g_game;
 Monsters g_monsters;
 Vocations g_vocations;
 extern Scripts* g_scripts;
+extern LuaEnvironment g_luaEnvironment;
 
 std::mutex g_loaderLock;
 std::condition_variable g_loaderSignal;
@@ -97,6 +99,9 @@ void mainLoader(ServiceManager* services)
 	}
 	g_logger().setLevel(parseLogLevel(getString(ConfigManager::LOG_LEVEL)));
 
+	g_luaEnvironment.configureGarbageCollector();
+	g_dispatcher.setIdleTask([]() { g_luaEnvironment.collectGarbageStep(); });
+
 #ifdef _WIN32
 	auto defaultPriority = getString(ConfigManager::DEFAULT_PRIORITY);
 	if (caseInsensitiveEqual(defaultPriority, "high")) {
@@ -212,6 +217,11 @@ void mainLoader(ServiceManager* services)
 		return;
 	}
 
+	const NpcLoadStats& npcLoadStats = Npcs::getLoadStats();
+	g_logger().info("Loaded {} npc scripts in {} ms, {} KB of Lua memory ({} bytes per npc)", npcLoadStats.scripts,
+	                std::chrono::duration_cast<std::chrono::milliseconds>(npcLoadStats.time).count(),
+	                npcLoadStats.memory / 1024, npcLoadStats.memory / std::max<int64_t>(npcLoadStats.scripts, 1));
+
 	g_logger().info("Initializing gamestate");
 	g_game.setGameState(GAME_STATE_INIT);
 
@@ -297,6 +307,7 @@ void startServer()
 		serviceManager.run();
 	} else {
 		g_logger().error("No services running. The server is NOT online.");
+		g_monsters.stopPreload();
 		g_scheduler.shutdown();
 		g_databaseTasks.shutdown();
 		g_dispatcher.shutdown();
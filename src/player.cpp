@@ -37,7 +37,6 @@ void trimString(std::string& str) { boost::algorithm::trim(str); }
 
 MuteCountMap Player::muteCountMap;
 
-uint32_t Player::playerAutoID = 0x10000000;
 std::forward_list<Condition*> Player::storedConditionList;
 
 Player::Player(ProtocolGame_ptr p) : Creature(), lastPing(OTSYS_TIME()), lastPong(lastPing), client(std::move(p))
@@ -57,6 +56,17 @@ Player::~Player()
 
 	setWriteItem(nullptr);
 	setEditHouse(nullptr);
+
+	if (id != 0) {
+		g_game.releasePlayerId(id);
+	}
+}
+
+void Player::setID()
+{
+	if (id == 0) {
+		id = g_game.reservePlayerId();
+	}
 }
 
 bool Player::setVocation(uint16_t vocId)
@@ -757,8 +767,23 @@ bool Player::isNearDepotBox() const
 	return false;
 }
 
+void Player::loadDepot()
+{
+	if (depotLoaded) {
+		return;
+	}
+
+	// set first, the loader adds the items through getDepotLocker and getDepotChest
+	depotLoaded = true;
+	if (guid != 0) {
+		IOLoginData::loadPlayerDepot(this);
+	}
+}
+
 DepotChest* Player::getDepotChest(uint32_t depotId, bool autoCreate)
 {
+	loadDepot();
+
 	auto it = depotChests.find(depotId);
 	if (it != depotChests.end()) {
 		return it->second;
@@ -775,6 +800,8 @@ DepotChest* Player::getDepotChest(uint32_t depotId, bool autoCreate)
 
 DepotLocker* Player::getDepotLocker(uint32_t depotId)
 {
+	loadDepot();
+
 	auto it = depotLockerMap.find(depotId);
 	if (it != depotLockerMap.end()) {
 		it->second->stopDecaying();
@@ -791,6 +818,9 @@ RewardChest& Player::getRewardChest()
 {
 	if (!rewardChest) {
 		rewardChest = std::make_shared<RewardChest>(ITEM_REWARD_CHEST);
+		if (guid != 0) {
+			IOLoginData::loadPlayerRewardChest(this);
+		}
 	}
 	return *rewardChest;
 }
@@ -1215,7 +1245,7 @@ void Player::onWalk(Direction& dir)
 {
 	const Position& fromPos = getPosition();
 	const Position& toPos = getNextPosition(dir, fromPos);
-	if (!g_events->eventPlayerOnStepTile(this, fromPos, toPos)) {
+	if (g_events->hasHook(EventHook::PLAYER_ONSTEPTILE) && !g_events->eventPlayerOnStepTile(this, fromPos, toPos)) {
 		return;
 	}
 
@@ -2749,6 +2779,7 @@ void Player::addThing(int32_t index, Thing* thing)
 
 	item->setParent(this);
 	inventory[index] = item;
+	addItemTypeCounts(item);
 
 	// send to client
 	sendInventoryItem(static_cast<slots_t>(index), item);
@@ -2766,8 +2797,10 @@ void Player::updateThing(Thing* thing, uint16_t itemId, uint32_t count)
 		return /*RETURNVALUE_NOTPOSSIBLE*/;
 	}
 
+	changeItemTypeCount(item->getID(), -static_cast<int32_t>(item->getItemCount()));
 	item->setID(itemId);
 	item->setSubType(static_cast<uint16_t>(count));
+	changeItemTypeCount(item->getID(), item->getItemCount());
 
 	// send to client
 	sendInventoryItem(static_cast<slots_t>(index), item);
@@ -2801,6 +2834,8 @@ void Player::replaceThing(uint32_t index, Thing* thing)
 	item->setParent(this);
 
 	inventory[index] = item;
+	removeItemTypeCounts(oldItem);
+	addItemTypeCounts(item);
 }
 
 void Player::removeThing(Thing* thing, uint32_t count)
@@ -2825,8 +2860,10 @@ void Player::removeThing(Thing* thing, uint32_t count)
 
 			item->setParent(nullptr);
 			inventory[index] = nullptr;
+			removeItemTypeCounts(item);
 		} else {
 			uint8_t newCount = static_cast<uint8_t>(std::max<int32_t>(0, item->getItemCount() - count));
+			changeItemTypeCount(item->getID(), newCount - item->getItemCount());
 			item->setItemCount(newCount);
 
 			// send change to client
@@ -2844,6 +2881,7 @@ void Player::removeThing(Thing* thing, uint32_t count)
 
 		item->setParent(nullptr);
 		inventory[index] = nullptr;
+		removeItemTypeCounts(item);
 	}
 }
 
@@ -2863,6 +2901,13 @@ size_t Player::getLastIndex() const { return CONST_SLOT_LAST + 1; }
 
 uint32_t Player::getItemTypeCount(uint16_t itemId, int32_t subType /*= -1*/) const
 {
+	if (subType == -1) {
+		const auto& counts = getItemTypeCounts();
+		auto it = counts.find(itemId);
+		return it != counts.end() ? it->second : 0;
+	}
+
+	// fluid types and charges can change without the inventory being notified, they are not indexed
 	uint32_t count = 0;
 	for (int32_t i = CONST_SLOT_FIRST; i <= CONST_SLOT_LAST; i++) {
 		Item* item = inventory[i];
@@ -2891,6 +2936,13 @@ bool Player::removeItemOfType(uint16_t itemId, uint32_t amount, int32_t subType,
 		return true;
 	}
 
+	// not carrying enough is answered by the index, the inventory is only walked to pick the items to remove
+	const auto& counts = getItemTypeCounts();
+	auto carried = counts.find(itemId);
+	if (carried == counts.end() || (subType == -1 && carried->second < amount)) {
+		return false;
+	}
+
 	std::vector<Item*> itemList;
 
 	uint32_t count = 0;
@@ -2938,21 +2990,72 @@ bool Player::removeItemOfType(uint16_t itemId, uint32_t amount, int32_t subType,
 
 std::map<uint32_t, uint32_t>& Player::getAllItemTypeCount(std::map<uint32_t, uint32_t>& countMap) const
 {
+	for (const auto& [itemId, count] : getItemTypeCounts()) {
+		countMap[itemId] += count;
+	}
+	return countMap;
+}
+
+const std::unordered_map<uint16_t, uint32_t>& Player::getItemTypeCounts() const
+{
+	if (!itemTypeCountsDirty) {
+		return itemTypeCounts;
+	}
+
+	itemTypeCounts.clear();
 	for (int32_t i = CONST_SLOT_FIRST; i <= CONST_SLOT_LAST; i++) {
 		Item* item = inventory[i];
 		if (!item) {
 			continue;
 		}
 
-		countMap[item->getID()] += Item::countByType(item, -1);
+		itemTypeCounts[item->getID()] += Item::countByType(item, -1);
 
 		if (Container* container = item->getContainer()) {
 			for (ContainerIterator it = container->iterator(); it.hasNext(); it.advance()) {
-				countMap[(*it)->getID()] += Item::countByType(*it, -1);
+				itemTypeCounts[(*it)->getID()] += Item::countByType(*it, -1);
 			}
 		}
 	}
-	return countMap;
+
+	itemTypeCountsDirty = false;
+	return itemTypeCounts;
+}
+
+void Player::changeItemTypeCount(uint16_t itemId, int32_t diff) const
+{
+	// the first query builds the counts from scratch, nothing to keep up to date until then
+	if (itemTypeCountsDirty || diff == 0) {
+		return;
+	}
+
+	auto it = itemTypeCounts.find(itemId);
+	if (it == itemTypeCounts.end()) {
+		if (diff < 0) {
+			itemTypeCountsDirty = true;
+			return;
+		}
+		itemTypeCounts.emplace(itemId, static_cast<uint32_t>(diff));
+		return;
+	}
+
+	if (diff < 0 && it->second < static_cast<uint32_t>(-diff)) {
+		// something changed the inventory behind our back, start over
+		itemTypeCountsDirty = true;
+	} else if ((it->second += diff) == 0) {
+		itemTypeCounts.erase(it);
+	}
+}
+
+void Player::changeItemTypeCounts(const Item* item, int32_t sign) const
+{
+	changeItemTypeCount(item->getID(), sign * item->getItemCount());
+
+	if (const Container* container = item->getContainer()) {
+		for (ContainerIterator it = container->iterator(); it.hasNext(); it.advance()) {
+			changeItemTypeCount((*it)->getID(), sign * (*it)->getItemCount());
+		}
+	}
 }
 
 Thing* Player::getThing(size_t index) const
@@ -3142,6 +3245,7 @@ void Player::internalAddThing(uint32_t index, Thing* thing)
 
 		inventory[index] = item;
 		item->setParent(this);
+		addItemTypeCounts(item);
 	}
 }
 
@@ -96,12 +96,7 @@ public:
 	Player* getPlayer() override { return this; }
 	const Player* getPlayer() const override { return this; }
 
-	void setID() override
-	{
-		if (id == 0) {
-			id = playerAutoID++;
-		}
-	}
+	void setID() override;
 
 	virtual void setLossSkill(bool _skillLoss);
 
@@ -1008,6 +1003,11 @@ public:
 
 	uint32_t getItemTypeCount(uint16_t itemId, int32_t subType = -1) const override;
 
+	// keep the per-type counts in step with the inventory, called by the player and container mutators
+	void addItemTypeCounts(const Item* item) const { changeItemTypeCounts(item, 1); }
+	void removeItemTypeCounts(const Item* item) const { changeItemTypeCounts(item, -1); }
+	void changeItemTypeCount(uint16_t itemId, int32_t diff) const;
+
 	void setStaminaMinutes(uint16_t newStamina) { staminaMinutes = std::min<uint16_t>(2520, newStamina); }
 
 	void incrementWindowTextId() { windowTextId++; }
@@ -1028,14 +1028,13 @@ public:
 	bool hasDebugAssertSent() const { return client ? client->debugAssertSent : false; }
 	bool isOTCv8() const { return client ? client->isOTCv8 : false; }
 
-	static uint32_t playerAutoID;
-
 	uint32_t totalReduceSkillLoss = 0;
 
 private:
 	std::forward_list<Condition*> getMuteConditions() const;
 
 	void checkTradeState(const Item* item);
+	void loadDepot();
 	bool hasCapacity(const Item* item, uint32_t count) const;
 
 	void handleNamelockManager(const std::string& text, std::ostringstream& msg, bool& shouldShowHelp);
@@ -1079,6 +1078,8 @@ private:
 	size_t getFirstIndex() const override;
 	size_t getLastIndex() const override;
 	std::map<uint32_t, uint32_t>& getAllItemTypeCount(std::map<uint32_t, uint32_t>& countMap) const override;
+	const std::unordered_map<uint16_t, uint32_t>& getItemTypeCounts() const;
+	void changeItemTypeCounts(const Item* item, int32_t sign) const;
 
 	void internalAddThing(Thing* thing) override;
 	void internalAddThing(uint32_t index, Thing* thing) override;
@@ -1089,6 +1090,8 @@ private:
 	std::map<uint8_t, OpenContainer> openContainers;
 	std::map<uint32_t, DepotLocker_ptr> depotLockerMap;
 	std::map<uint32_t, DepotChest*> depotChests;
+	// depot lockers and chests are loaded from the database the first time one of them is accessed
+	bool depotLoaded = false;
 
 	std::unordered_map<uint16_t, uint8_t> outfits;
 	std::unordered_set<uint16_t> mounts;
@@ -1135,6 +1138,9 @@ private:
 	Group* group = nullptr;
 	Item* tradeItem = nullptr;
 	Item* inventory[CONST_SLOT_LAST + 1] = {};
+	// itemId -> count of everything in the inventory, built by the first query and then kept up to date
+	mutable std::unordered_map<uint16_t, uint32_t> itemTypeCounts;
+	mutable bool itemTypeCountsDirty = true;
 	Item* writeItem = nullptr;
 	House* editHouse = nullptr;
 	Npc* shopOwner = nullptr;
@@ -63,6 +63,15 @@ struct Position
 	constexpr int16_t getZ() const { return z; }
 };
 
+template <>
+struct std::hash<Position>
+{
+	size_t operator()(const Position& p) const noexcept
+	{
+		return std::hash<uint64_t>{}((static_cast<uint64_t>(p.z) << 32) | (static_cast<uint64_t>(p.y) << 16) | p.x);
+	}
+};
+
 std::ostream& operator<<(std::ostream&, const Position&);
 
 #endif // FS_POSITION_H
@@ -0,0 +1,115 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#ifndef FS_PREFIXTREE_H
+#define FS_PREFIXTREE_H
+
+// Case-insensitive prefix index used to resolve spoken words (spells, talkactions) without scanning every entry.
+// Keys are not copied, they must outlive the tree (e.g. the key of the owning std::map node).
+template <typename T>
+class PrefixTree
+{
+	using Entry = std::pair<std::string_view, T*>;
+
+	struct Node
+	{
+		std::vector<std::pair<char, uint32_t>> children;
+		std::vector<Entry> entries;
+	};
+
+public:
+	PrefixTree() { clear(); }
+
+	// non-copyable
+	PrefixTree(const PrefixTree&) = delete;
+	PrefixTree& operator=(const PrefixTree&) = delete;
+
+	void insert(std::string_view key, T* value)
+	{
+		uint32_t index = 0;
+		for (char ch : key) {
+			index = getOrAddChild(index, fold(ch));
+		}
+
+		// keys that only differ in case share a node, keep them in the same order std::map would
+		auto& entries = nodes[index].entries;
+		auto it = std::upper_bound(entries.begin(), entries.end(), key,
+		                           [](std::string_view lhs, const Entry& rhs) { return lhs < rhs.first; });
+		entries.emplace(it, key, value);
+	}
+
+	void clear()
+	{
+		nodes.clear();
+		nodes.emplace_back();
+	}
+
+	bool empty() const { return nodes.size() == 1 && nodes.front().entries.empty(); }
+
+	// Returns the entry with the longest key that is a case-insensitive prefix of str.
+	const Entry* findLongestPrefix(std::string_view str) const
+	{
+		const Entry* result = nullptr;
+
+		uint32_t index = 0;
+		for (size_t pos = 0;; ++pos) {
+			const auto& entries = nodes[index].entries;
+			if (!entries.empty()) {
+				result = &entries.front();
+			}
+
+			if (pos == str.size() || (index = getChild(index, fold(str[pos]))) == 0) {
+				return result;
+			}
+		}
+	}
+
+	// Calls func(key, value) for every entry whose key is a case-insensitive prefix of str, shortest key first, and
+	// returns the first value accepted by func. Keys of the same length are visited in std::map order, so unlike
+	// iterating a std::map, "!a" comes before "!AB".
+	template <typename Func>
+	T* findPrefix(std::string_view str, Func&& func) const
+	{
+		uint32_t index = 0;
+		for (size_t pos = 0;; ++pos) {
+			for (const auto& [key, value] : nodes[index].entries) {
+				if (func(key, *value)) {
+					return value;
+				}
+			}
+
+			if (pos == str.size() || (index = getChild(index, fold(str[pos]))) == 0) {
+				return nullptr;
+			}
+		}
+	}
+
+private:
+	static char fold(char ch) { return static_cast<char>(std::tolower(static_cast<unsigned char>(ch))); }
+
+	// the root is never a child, so 0 doubles as "not found"
+	uint32_t getChild(uint32_t index, char ch) const
+	{
+		for (const auto& [childChar, childIndex] : nodes[index].children) {
+			if (childChar == ch) {
+				return childIndex;
+			}
+		}
+		return 0;
+	}
+
+	uint32_t getOrAddChild(uint32_t index, char ch)
+	{
+		uint32_t child = getChild(index, ch);
+		if (child == 0) {
+			child = static_cast<uint32_t>(nodes.size());
+			nodes[index].children.emplace_back(ch, child);
+			nodes.emplace_back();
+		}
+		return child;
+	}
+
+	std::vector<Node> nodes;
+};
+
+#endif // FS_PREFIXTREE_H
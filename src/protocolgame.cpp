@@ -8,8 +8,10 @@
 #include "actions.h"
 #include "ban.h"
 #include "configmanager.h"
+#include "databasetasks.h"
 #include "game.h"
 #include "iologindata.h"
+#include "logger.h"
 #include "outputmessage.h"
 #include "player.h"
 #include "scheduler.h"
@@ -154,6 +156,10 @@ void ProtocolGame::login(uint32_t characterId, uint32_t accountId, OperatingSyst
 
 		player->incrementReferenceCounter();
 		player->setID();
+		if (player->getID() == 0) {
+			disconnectClient("The server is full. Please try again later.");
+			return;
+		}
 
 		if (!IOLoginData::preloadPlayer(player)) {
 			disconnectClient("Your character could not be loaded.");
@@ -234,70 +240,125 @@ void ProtocolGame::login(uint32_t characterId, uint32_t accountId, OperatingSyst
 			return;
 		}
 
-		if (!IOLoginData::loadPlayerById(player, player->getGUID())) {
+		// the queries run on the database thread, finishLogin builds and places the player on the dispatcher
+		const uint32_t guid = player->getGUID();
+		const uint64_t loginToken = IOLoginData::beginLogin(guid);
+		if (!g_databaseTasks.addJob([thisPtr = getThis(), guid, loginToken, accountId, operatingSystem,
+		                             queued = OTSYS_TIME()](Database& db) {
+			    g_dispatcher.addTask([=, data = IOLoginData::fetchPlayerById(db, guid)]() mutable {
+				    if (IOLoginData::endLogin(guid, loginToken)) {
+					    // the player was saved or changed by a script while offline, the fetched rows are outdated
+					    data = IOLoginData::fetchPlayerById(Database::getInstance(), guid);
+				    }
+				    thisPtr->finishLogin(data, accountId, operatingSystem, queued);
+			    });
+		    })) {
+			IOLoginData::endLogin(guid, loginToken);
 			disconnectClient("Your character could not be loaded.");
 			return;
 		}
+	} else {
+		replaceLogin(foundPlayer, operatingSystem);
+	}
+	OutputMessagePool::getInstance().addProtocolToAutosend(shared_from_this());
+}
 
-		player->setOperatingSystem(operatingSystem);
+void ProtocolGame::finishLogin(const PlayerLoadData& data, uint32_t accountId, OperatingSystem_t operatingSystem,
+                               int64_t queued)
+{
+	// dispatcher thread
+	if (!player || isConnectionExpired()) {
+		// the client went away while its data was being fetched, release() already dropped the player
+		return;
+	}
 
-		if (!g_game.placeCreature(player, player->getLoginPosition())) {
-			if (!g_game.placeCreature(player, player->getTemplePosition(), false, true)) {
-				disconnectClient("Temple position is wrong. Contact the administrator.");
-				return;
-			}
-		}
+	int64_t start = OTSYS_TIME();
 
-		if (operatingSystem >= CLIENTOS_OTCLIENT_LINUX) {
-			player->registerCreatureEvent("ExtendedOpcode");
+	// another login of the same character may have been placed while this one waited for its data, take it over
+	// the same way login() would have if it had been placed first
+	Player* foundPlayer = g_game.getPlayerByGUID(player->getGUID());
+	if (foundPlayer && foundPlayer != player && player->getName() != "Account Manager" &&
+	    !getBoolean(ConfigManager::ALLOW_CLONES)) {
+		if (eventConnect == 0 && getBoolean(ConfigManager::REPLACE_KICK_ON_LOGIN)) {
+			player->client.reset();
+			player->decrementReferenceCounter();
+			player = nullptr;
 		}
+		replaceLogin(foundPlayer, operatingSystem);
+		return;
+	}
 
-		// Setup Account Manager mode (only if not already set by namelock handler above)
-		if (ConfigManager::getBoolean(ConfigManager::ACCOUNT_MANAGER) && name == "Account Manager" &&
-		    player->getAccountManagerMode() == ACCOUNT_MANAGER_NONE) {
-			if (accountId == 1) {
-				player->setAccountManagerMode(ACCOUNT_MANAGER_NEW);
-				player->sendTextMessage(
-				    MESSAGE_STATUS_CONSOLE_ORANGE,
-				    "Account Manager: Welcome! You are now speaking with the Account Manager. To create a new account, type {account}. If you already have one and need to recover it, type {recover}. Type {cancel} anytime to restart this conversation.");
-			} else {
-				player->setAccountManagerMode(ACCOUNT_MANAGER_ACCOUNT);
-				player->setAccountManagerData(accountId);
-				player->resetTalkState(0, 0);
-				player->setManagerTalkState(1, true);
-				player->sendTextMessage(
-				    MESSAGE_STATUS_CONSOLE_ORANGE,
-				    "Account Manager: Welcome back. Type {account} to manage your account, {character} to create a new character, or {cancel} to start over.");
-			}
-		}
-		// Block movement for all Account Manager modes
-		if (player->isAccountManager()) {
-			player->setMovementBlocked(true);
-		}
+	if (!IOLoginData::loadPlayer(player, data)) {
+		disconnectClient("Your character could not be loaded.");
+		return;
+	}
 
-		player->lastIP = player->getIP();
-		player->lastLoginSaved = std::max<time_t>(time(nullptr), player->lastLoginSaved + 1);
-		acceptPackets = true;
-	} else {
-		if (eventConnect != 0 || !getBoolean(ConfigManager::REPLACE_KICK_ON_LOGIN)) {
-			// Already trying to connect
-			disconnectClient("You are already logged in.");
+	const std::string name = player->getName();
+
+	player->setOperatingSystem(operatingSystem);
+
+	if (!g_game.placeCreature(player, player->getLoginPosition())) {
+		if (!g_game.placeCreature(player, player->getTemplePosition(), false, true)) {
+			disconnectClient("Temple position is wrong. Contact the administrator.");
 			return;
 		}
+	}
 
-		if (foundPlayer->client) {
-			foundPlayer->disconnect();
-			foundPlayer->isConnecting = true;
+	if (operatingSystem >= CLIENTOS_OTCLIENT_LINUX) {
+		player->registerCreatureEvent("ExtendedOpcode");
+	}
 
-			eventConnect = g_scheduler.addEvent(
-			    createSchedulerTask(1000, [=, thisPtr = getThis(), playerID = foundPlayer->getID()]() {
-				    thisPtr->connect(playerID, operatingSystem);
-			    }));
+	// Setup Account Manager mode (only if not already set by the namelock handler in login)
+	if (ConfigManager::getBoolean(ConfigManager::ACCOUNT_MANAGER) && name == "Account Manager" &&
+	    player->getAccountManagerMode() == ACCOUNT_MANAGER_NONE) {
+		if (accountId == 1) {
+			player->setAccountManagerMode(ACCOUNT_MANAGER_NEW);
+			player->sendTextMessage(
+			    MESSAGE_STATUS_CONSOLE_ORANGE,
+			    "Account Manager: Welcome! You are now speaking with the Account Manager. To create a new account, type {account}. If you already have one and need to recover it, type {recover}. Type {cancel} anytime to restart this conversation.");
 		} else {
-			connect(foundPlayer->getID(), operatingSystem);
+			player->setAccountManagerMode(ACCOUNT_MANAGER_ACCOUNT);
+			player->setAccountManagerData(accountId);
+			player->resetTalkState(0, 0);
+			player->setManagerTalkState(1, true);
+			player->sendTextMessage(
+			    MESSAGE_STATUS_CONSOLE_ORANGE,
+			    "Account Manager: Welcome back. Type {account} to manage your account, {character} to create a new character, or {cancel} to start over.");
 		}
 	}
-	OutputMessagePool::getInstance().addProtocolToAutosend(shared_from_this());
+	// Block movement for all Account Manager modes
+	if (player->isAccountManager()) {
+		player->setMovementBlocked(true);
+	}
+
+	player->lastIP = player->getIP();
+	player->lastLoginSaved = std::max<time_t>(time(nullptr), player->lastLoginSaved + 1);
+	acceptPackets = true;
+
+	int64_t now = OTSYS_TIME();
+	LOG_DEBUG("Login of {:s}: {:d} ms database, {:d} ms game, {:d} ms total", name, data.fetchTime, now - start,
+	          now - queued);
+}
+
+void ProtocolGame::replaceLogin(Player* foundPlayer, OperatingSystem_t operatingSystem)
+{
+	if (eventConnect != 0 || !getBoolean(ConfigManager::REPLACE_KICK_ON_LOGIN)) {
+		// Already trying to connect
+		disconnectClient("You are already logged in.");
+		return;
+	}
+
+	if (foundPlayer->client) {
+		foundPlayer->disconnect();
+		foundPlayer->isConnecting = true;
+
+		eventConnect =
+		    g_scheduler.addEvent(createSchedulerTask(1000, [=, thisPtr = getThis(), playerID = foundPlayer->getID()]() {
+			    thisPtr->connect(playerID, operatingSystem);
+		    }));
+	} else {
+		connect(foundPlayer->getID(), operatingSystem);
+	}
 }
 
 void ProtocolGame::connect(uint32_t playerId, OperatingSystem_t operatingSystem)
@@ -17,6 +17,7 @@ class Container;
 class Tile;
 class Connection;
 class ProtocolGame;
+struct PlayerLoadData;
 using ProtocolGame_ptr = std::shared_ptr<ProtocolGame>;
 
 extern Game g_game;
@@ -67,6 +68,9 @@ public:
 
 private:
 	ProtocolGame_ptr getThis() { return std::static_pointer_cast<ProtocolGame>(shared_from_this()); }
+	void finishLogin(const PlayerLoadData& data, uint32_t accountId, OperatingSystem_t operatingSystem,
+	                 int64_t queued);
+	void replaceLogin(Player* foundPlayer, OperatingSystem_t operatingSystem);
 	void connect(uint32_t playerId, OperatingSystem_t operatingSystem);
 	void disconnectClient(std::string_view message) const;
 	void writeToOutputBuffer(const NetworkMessage& msg);
@@ -0,0 +1,80 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#include "otpch.h"
+
+#include "scriptprofiler.h"
+
+#include <fstream>
+
+ScriptProfiler g_scriptProfiler;
+
+void ScriptProfiler::start()
+{
+	stack.clear();
+	frames.clear();
+	stacks.clear();
+	running = true;
+}
+
+std::string ScriptProfiler::stop()
+{
+	running = false;
+	stack.clear();
+	frames.clear();
+
+	std::string fileName = fmt::format("data/logs/scripts-{:%Y%m%d-%H%M%S}.folded", fmt::localtime(time(nullptr)));
+	std::ofstream file{fileName};
+	if (!file) {
+		std::cout << "[Warning - ScriptProfiler::stop] Could not write " << fileName << std::endl;
+		return {};
+	}
+
+	file << getFoldedStacks();
+	stacks.clear();
+	return fileName;
+}
+
+void ScriptProfiler::enter(std::string_view name)
+{
+	frames.push_back({stack.size(), Clock::now()});
+	if (!stack.empty()) {
+		stack.push_back(';');
+	}
+
+	// ';' separates the frames of a folded stack
+	size_t offset = stack.size();
+	stack.append(name);
+	std::replace(stack.begin() + offset, stack.end(), ';', ',');
+}
+
+void ScriptProfiler::leave()
+{
+	if (frames.empty()) {
+		return;
+	}
+
+	Frame frame = frames.back();
+	frames.pop_back();
+
+	auto elapsed = Clock::now() - frame.start;
+	stacks[stack] += elapsed - frame.children;
+
+	stack.resize(frame.parentLength);
+	if (!frames.empty()) {
+		frames.back().children += elapsed;
+	}
+}
+
+std::string ScriptProfiler::getFoldedStacks() const
+{
+	std::vector<std::pair<std::string_view, Clock::duration>> sorted{stacks.begin(), stacks.end()};
+	std::sort(sorted.begin(), sorted.end());
+
+	std::string result;
+	for (const auto& [name, time] : sorted) {
+		auto self = std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+		fmt::format_to(std::back_inserter(result), "{:s} {:d}\n", name, self);
+	}
+	return result;
+}
@@ -0,0 +1,48 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#ifndef FS_SCRIPTPROFILER_H
+#define FS_SCRIPTPROFILER_H
+
+// Times every Lua call made through LuaScriptInterface::protectedCall while it runs. A call that triggers another
+// script (an item moved by a script firing a movement, for example) nests it, so the time is attributed to the whole
+// chain of scripts and written as folded stacks ("outer;inner microseconds"), the input flamegraph.pl and speedscope
+// expect. While stopped it costs one branch per call.
+class ScriptProfiler
+{
+public:
+	bool isRunning() const { return running; }
+
+	// discards anything collected before
+	void start();
+	// writes the collected stacks to data/logs and returns the file name, empty if it could not be written
+	std::string stop();
+
+	// every enter while running has to be paired with a leave, a leave whose enter was dropped by start or stop is
+	// ignored
+	void enter(std::string_view name);
+	void leave();
+
+	// one "stack self-time" line per distinct stack, self time in microseconds
+	std::string getFoldedStacks() const;
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Frame
+	{
+		size_t parentLength;
+		Clock::time_point start;
+		Clock::duration children{};
+	};
+
+	std::string stack;
+	std::vector<Frame> frames;
+	// self time of every distinct stack
+	std::unordered_map<std::string, Clock::duration> stacks;
+	bool running = false;
+};
+
+extern ScriptProfiler g_scriptProfiler;
+
+#endif // FS_SCRIPTPROFILER_H
@@ -0,0 +1,99 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#include "otpch.h"
+
+#include "slab.h"
+
+namespace {
+
+struct SlabRegistry
+{
+	std::mutex mutex;
+	std::vector<const SlabAllocator*> allocators;
+};
+
+SlabRegistry& getSlabRegistry()
+{
+	// never destroyed, like the allocators themselves
+	static auto* registry = new SlabRegistry();
+	return *registry;
+}
+
+size_t alignSlot(size_t size)
+{
+	constexpr size_t alignment = alignof(std::max_align_t);
+	return (std::max(size, sizeof(void*)) + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+SlabAllocator::SlabAllocator(std::string_view name, size_t objectSize, size_t objectsPerSlab /* = 4096*/) :
+    name(name), objectSize(objectSize), slotSize(alignSlot(objectSize)), objectsPerSlab(objectsPerSlab)
+{
+	auto& registry = getSlabRegistry();
+	std::lock_guard<std::mutex> lockClass(registry.mutex);
+	registry.allocators.push_back(this);
+}
+
+void* SlabAllocator::allocate(size_t size)
+{
+	if (size != objectSize) {
+		return ::operator new(size);
+	}
+
+	std::lock_guard<std::mutex> lockClass(mutex);
+
+	void* p;
+	if (freeList) {
+		p = freeList;
+		freeList = freeList->next;
+	} else {
+		if (slabCursor == slabEnd) {
+			slabCursor = static_cast<char*>(::operator new(slotSize * objectsPerSlab));
+			slabEnd = slabCursor + slotSize * objectsPerSlab;
+			capacity += objectsPerSlab;
+		}
+
+		p = slabCursor;
+		slabCursor += slotSize;
+	}
+
+	peak = std::max(peak, ++live);
+	return p;
+}
+
+void SlabAllocator::deallocate(void* p, size_t size)
+{
+	if (!p) {
+		return;
+	}
+
+	if (size != objectSize) {
+		::operator delete(p);
+		return;
+	}
+
+	std::lock_guard<std::mutex> lockClass(mutex);
+	freeList = new (p) FreeNode{freeList};
+	--live;
+}
+
+SlabAllocator::Stats SlabAllocator::getStats() const
+{
+	std::lock_guard<std::mutex> lockClass(mutex);
+	return {name, objectSize, live, peak, capacity};
+}
+
+std::vector<SlabAllocator::Stats> SlabAllocator::getAllStats()
+{
+	auto& registry = getSlabRegistry();
+	std::lock_guard<std::mutex> lockClass(registry.mutex);
+
+	std::vector<Stats> stats;
+	stats.reserve(registry.allocators.size());
+	for (const SlabAllocator* allocator : registry.allocators) {
+		stats.push_back(allocator->getStats());
+	}
+	return stats;
+}
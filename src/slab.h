@@ -0,0 +1,58 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#ifndef FS_SLAB_H
+#define FS_SLAB_H
+
+// Pool for objects of one size that are allocated by the million (items, containers, tiles). Objects are carved out of
+// large slabs and recycled through a freelist; slab memory is never given back to the system. Requests for any other
+// size (derived classes inheriting the class operator new) are passed on to the global allocator.
+class SlabAllocator
+{
+public:
+	struct Stats
+	{
+		std::string_view name;
+		size_t objectSize;
+		uint64_t live;
+		uint64_t peak;
+		uint64_t capacity;
+	};
+
+	SlabAllocator(std::string_view name, size_t objectSize, size_t objectsPerSlab = 4096);
+
+	// non-copyable
+	SlabAllocator(const SlabAllocator&) = delete;
+	SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+	void* allocate(size_t size);
+	void deallocate(void* p, size_t size);
+
+	Stats getStats() const;
+
+	// stats of every slab allocator created so far, in creation order
+	static std::vector<Stats> getAllStats();
+
+private:
+	struct FreeNode
+	{
+		FreeNode* next;
+	};
+
+	const std::string_view name;
+	const size_t objectSize;
+	const size_t slotSize;
+	const size_t objectsPerSlab;
+
+	mutable std::mutex mutex;
+	FreeNode* freeList = nullptr;
+	// unused tail of the newest slab
+	char* slabCursor = nullptr;
+	char* slabEnd = nullptr;
+
+	uint64_t live = 0;
+	uint64_t peak = 0;
+	uint64_t capacity = 0;
+};
+
+#endif // FS_SLAB_H
@@ -36,6 +36,12 @@ public:
 		vec.pop_back();
 	}
 
+	template <typename Predicate>
+	void eraseIf(Predicate&& predicate)
+	{
+		std::erase_if(vec, std::forward<Predicate>(predicate));
+	}
+
 	size_t size() const { return vec.size(); }
 	bool empty() const { return vec.empty(); }
 	Iterator begin() { return vec.begin(); }
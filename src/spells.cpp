@@ -79,18 +79,22 @@ TalkActionResult Spells::playerSaySpell(Player* player, std::string& words)
 
 void Spells::clearMaps(bool fromLua)
 {
+	instantsByWords.clear();
 	for (auto instant = instants.begin(); instant != instants.end();) {
 		if (fromLua == instant->second.fromLua) {
 			instant = instants.erase(instant);
 		} else {
+			instantsByWords.insert(instant->first, &instant->second);
 			++instant;
 		}
 	}
 
+	Item::items.resetScriptEvents(ITEM_SCRIPT_RUNE);
 	for (auto rune = runes.begin(); rune != runes.end();) {
 		if (fromLua == rune->second.fromLua) {
 			rune = runes.erase(rune);
 		} else {
+			Item::items.setScriptEvent(rune->first, ITEM_SCRIPT_RUNE);
 			++rune;
 		}
 	}
@@ -125,8 +129,11 @@ bool Spells::registerEvent(Event_ptr event, const pugi::xml_node&)
 		if (!result.second) {
 			std::cout << "[Warning - Spells::registerEvent] Duplicate registered instant spell with words: "
 			          << instant->getWords() << std::endl;
+			return false;
 		}
-		return result.second;
+
+		instantsByWords.insert(result.first->first, &result.first->second);
+		return true;
 	}
 
 	RuneSpell* rune = dynamic_cast<RuneSpell*>(event.get());
@@ -135,8 +142,11 @@ bool Spells::registerEvent(Event_ptr event, const pugi::xml_node&)
 		if (!result.second) {
 			std::cout << "[Warning - Spells::registerEvent] Duplicate registered rune with id: "
 			          << rune->getRuneItemId() << std::endl;
+			return false;
 		}
-		return result.second;
+
+		Item::items.setScriptEvent(result.first->first, ITEM_SCRIPT_RUNE);
+		return true;
 	}
 
 	return false;
@@ -151,8 +161,11 @@ bool Spells::registerInstantLuaEvent(InstantSpell* event)
 		if (!result.second) {
 			std::cout << "[Warning - Spells::registerInstantLuaEvent] Duplicate registered instant spell with words: "
 			          << words << std::endl;
+			return false;
 		}
-		return result.second;
+
+		instantsByWords.insert(result.first->first, &result.first->second);
+		return true;
 	}
 
 	return false;
@@ -167,8 +180,11 @@ bool Spells::registerRuneLuaEvent(RuneSpell* event)
 		if (!result.second) {
 			std::cout << "[Warning - Spells::registerRuneLuaEvent] Duplicate registered rune with id: " << id
 			          << std::endl;
+			return false;
 		}
-		return result.second;
+
+		Item::items.setScriptEvent(id, ITEM_SCRIPT_RUNE);
+		return true;
 	}
 
 	return false;
@@ -209,22 +225,9 @@ RuneSpell* Spells::getRuneSpellByName(std::string_view name)
 
 InstantSpell* Spells::getInstantSpell(std::string_view words)
 {
-	InstantSpell* result = nullptr;
-
-	for (auto& it : instants) {
-		auto instantSpellWords = it.second.getWords();
-		size_t spellLen = instantSpellWords.length();
-		if (caseInsensitiveStartsWith(words, instantSpellWords)) {
-			if (!result || spellLen > result->getWords().size()) {
-				result = &it.second;
-				if (words.length() == spellLen) {
-					break;
-				}
-			}
-		}
-	}
-
-	if (result) {
+	auto entry = instantsByWords.findLongestPrefix(words);
+	if (entry) {
+		InstantSpell* result = entry->second;
 		auto resultWords = result->getWords();
 		if (words.length() > resultWords.length()) {
 			if (!result->getHasParam()) {
@@ -338,8 +341,7 @@ bool CombatSpell::executeCastSpell(Creature* creature, const LuaVariant& var)
 
 	scriptInterface->pushFunction(scriptId);
 
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 
 	Lua::pushVariant(L, var);
 
@@ -1029,8 +1031,7 @@ bool InstantSpell::executeCastSpell(Creature* creature, const LuaVariant& var)
 
 	scriptInterface->pushFunction(scriptId);
 
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 
 	Lua::pushVariant(L, var);
 
@@ -1208,8 +1209,7 @@ bool RuneSpell::executeCastSpell(Creature* creature, const LuaVariant& var, bool
 
 	scriptInterface->pushFunction(scriptId);
 
-	Lua::pushUserdata<Creature>(L, creature);
-	Lua::setCreatureMetatable(L, -1, creature);
+	Lua::pushCreature(L, creature);
 
 	Lua::pushVariant(L, var);
 
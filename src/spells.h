@@ -7,6 +7,7 @@
 #include "actions.h"
 #include "baseevents.h"
 #include "player.h"
+#include "prefixtree.h"
 #include "talkaction.h"
 #include "vocation.h"
 
@@ -55,6 +56,7 @@ private:
 
 	std::map<uint16_t, RuneSpell> runes;
 	std::map<std::string, InstantSpell> instants;
+	PrefixTree<InstantSpell> instantsByWords;
 
 	friend class CombatSpell;
 	LuaScriptInterface scriptInterface{"Spell Interface"};
@@ -0,0 +1,85 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#include "otpch.h"
+
+#include "storagemap.h"
+
+#include "database.h"
+
+std::vector<std::string> getChangedStorageQueries(const StorageMap& storages, std::string_view table,
+                                                  std::string_view ownerColumn, uint32_t ownerId, size_t maxPacketSize)
+{
+	std::string deletePrefix = fmt::format("DELETE FROM `{:s}` WHERE ", table);
+	std::string insertPrefix = fmt::format("INSERT INTO `{:s}` ({:s}`key`, `value`) VALUES ", table,
+	                                       ownerColumn.empty() ? "" : fmt::format("`{:s}`, ", ownerColumn));
+	std::string owner;
+	if (!ownerColumn.empty()) {
+		deletePrefix += fmt::format("`{:s}` = {:d} AND ", ownerColumn, ownerId);
+		owner = fmt::format("{:d}, ", ownerId);
+	}
+	deletePrefix += "`key` IN (";
+
+	// every changed key is deleted, the ones that still have a value are inserted again; all deletes have to run
+	// before the first insert, or the insert of a key that is still in the table fails
+	std::vector<std::string> deletes, inserts;
+	std::string deleteQuery, insertQuery;
+	storages.forEachDirty([&](uint32_t key, std::optional<int64_t> value) {
+		std::string deleteKey = std::to_string(key);
+		// the pending query ends with a ',' that becomes the closing ')'
+		if (!deleteQuery.empty() && deleteQuery.length() + deleteKey.length() + 1 > maxPacketSize) {
+			deleteQuery.back() = ')';
+			deletes.push_back(std::move(deleteQuery));
+			deleteQuery.clear();
+		}
+		if (deleteQuery.empty()) {
+			deleteQuery = deletePrefix;
+		}
+		deleteQuery += deleteKey;
+		deleteQuery.push_back(',');
+
+		if (!value) {
+			return;
+		}
+
+		std::string row = fmt::format("({:s}{:d}, {:d})", owner, key, *value);
+		if (!insertQuery.empty() && insertQuery.length() + row.length() + 1 > maxPacketSize) {
+			inserts.push_back(std::move(insertQuery));
+			insertQuery.clear();
+		}
+		if (insertQuery.empty()) {
+			insertQuery = insertPrefix;
+		} else {
+			insertQuery.push_back(',');
+		}
+		insertQuery += row;
+	});
+
+	if (!deleteQuery.empty()) {
+		deleteQuery.back() = ')';
+		deletes.push_back(std::move(deleteQuery));
+	}
+	if (!insertQuery.empty()) {
+		inserts.push_back(std::move(insertQuery));
+	}
+
+	std::move(inserts.begin(), inserts.end(), std::back_inserter(deletes));
+	return deletes;
+}
+
+bool saveChangedStorages(const StorageMap& storages, std::string_view table, std::string_view ownerColumn,
+                         uint32_t ownerId)
+{
+	if (!storages.hasDirty()) {
+		return true;
+	}
+
+	Database& db = Database::getInstance();
+	for (const std::string& query :
+	     getChangedStorageQueries(storages, table, ownerColumn, ownerId, db.getMaxPacketSize())) {
+		if (!db.executeQuery(query)) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,202 @@
+// Copyright 2023 The Forgotten Server Authors. All rights reserved.
+// Use of this source code is governed by the GPL-2.0 License that can be found in the LICENSE file.
+
+#ifndef FS_STORAGEMAP_H
+#define FS_STORAGEMAP_H
+
+// Open addressing hash map keyed by a 32-bit id. Slots are stored inline in one array and probed linearly, erasing
+// shifts the following entries back so there are no tombstones.
+template <typename Value>
+class FlatHashMap
+{
+	struct Slot
+	{
+		uint32_t key;
+		bool used;
+		Value value;
+	};
+
+public:
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+
+	const Value* find(uint32_t key) const
+	{
+		if (slots.empty()) {
+			return nullptr;
+		}
+
+		for (size_t index = home(key);; index = next(index)) {
+			const Slot& slot = slots[index];
+			if (!slot.used) {
+				return nullptr;
+			} else if (slot.key == key) {
+				return &slot.value;
+			}
+		}
+	}
+
+	Value* find(uint32_t key) { return const_cast<Value*>(std::as_const(*this).find(key)); }
+
+	// returns true if the key was not in the map yet
+	bool insert_or_assign(uint32_t key, Value value)
+	{
+		// keep the load factor at or below 3/4
+		if ((count + 1) * 4 > slots.size() * 3) {
+			rehash(std::max<size_t>(16, slots.size() * 2));
+		}
+
+		for (size_t index = home(key);; index = next(index)) {
+			Slot& slot = slots[index];
+			if (!slot.used) {
+				slot = {key, true, std::move(value)};
+				++count;
+				return true;
+			} else if (slot.key == key) {
+				slot.value = std::move(value);
+				return false;
+			}
+		}
+	}
+
+	bool erase(uint32_t key)
+	{
+		if (slots.empty()) {
+			return false;
+		}
+
+		size_t index = home(key);
+		while (slots[index].used && slots[index].key != key) {
+			index = next(index);
+		}
+
+		if (!slots[index].used) {
+			return false;
+		}
+
+		// move back every following entry whose probe sequence passes through the freed slot
+		size_t hole = index;
+		for (size_t probe = next(hole); slots[probe].used; probe = next(probe)) {
+			size_t wanted = home(slots[probe].key);
+			if (((probe - wanted) & mask()) >= ((probe - hole) & mask())) {
+				slots[hole] = std::move(slots[probe]);
+				hole = probe;
+			}
+		}
+
+		slots[hole].used = false;
+		--count;
+		return true;
+	}
+
+	void clear()
+	{
+		slots.clear();
+		count = 0;
+	}
+
+	template <typename Func>
+	void forEach(Func&& func) const
+	{
+		for (const Slot& slot : slots) {
+			if (slot.used) {
+				func(slot.key, slot.value);
+			}
+		}
+	}
+
+private:
+	size_t mask() const { return slots.size() - 1; }
+	size_t next(size_t index) const { return (index + 1) & mask(); }
+	// Fibonacci hashing spreads the sequential keys storages tend to use
+	size_t home(uint32_t key) const { return (static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15) >> shift; }
+
+	void rehash(size_t capacity)
+	{
+		std::vector<Slot> oldSlots(capacity, Slot{0, false, Value{}});
+		oldSlots.swap(slots);
+		shift = 64 - std::countr_zero(capacity);
+		count = 0;
+
+		for (Slot& slot : oldSlots) {
+			if (slot.used) {
+				insert_or_assign(slot.key, std::move(slot.value));
+			}
+		}
+	}
+
+	std::vector<Slot> slots;
+	size_t count = 0;
+	int shift = 64;
+};
+
+// Storage values of a creature, an account or the game. Remembers which keys were set or erased since the last save,
+// so saving only has to write those.
+class StorageMap
+{
+public:
+	std::optional<int64_t> get(uint32_t key) const
+	{
+		if (const int64_t* value = values.find(key)) {
+			return *value;
+		}
+		return std::nullopt;
+	}
+
+	// an empty value erases the key, loading from the database passes markDirty = false
+	void set(uint32_t key, std::optional<int64_t> value, bool markDirty = true)
+	{
+		bool changed = true;
+		if (value) {
+			values.insert_or_assign(key, *value);
+		} else {
+			changed = values.erase(key);
+		}
+
+		if (changed && markDirty) {
+			dirtyKeys.insert_or_assign(key, true);
+		}
+	}
+
+	size_t size() const { return values.size(); }
+	bool empty() const { return values.empty(); }
+
+	template <typename Func>
+	void forEach(Func&& func) const
+	{
+		values.forEach(std::forward<Func>(func));
+	}
+
+	bool hasDirty() const { return !dirtyKeys.empty(); }
+
+	// calls func(key, value) for every key changed since the last clearDirty, value is empty for erased keys
+	template <typename Func>
+	void forEachDirty(Func&& func) const
+	{
+		dirtyKeys.forEach([&](uint32_t key, bool) { func(key, get(key)); });
+	}
+
+	void clearDirty() { dirtyKeys.clear(); }
+
+	void clear()
+	{
+		values.clear();
+		dirtyKeys.clear();
+	}
+
+private:
+	FlatHashMap<int64_t> values;
+	// used as a set, the value is ignored
+	FlatHashMap<bool> dirtyKeys;
+};
+
+// Writes the keys changed since the last clearDirty to table, rows are keyed by ownerColumn = ownerId unless
+// ownerColumn is empty. Run it inside a transaction and clear the dirty keys once that is committed.
+bool saveChangedStorages(const StorageMap& storages, std::string_view table, std::string_view ownerColumn = {},
+                         uint32_t ownerId = 0);
+// the statements saveChangedStorages runs in order: the changed keys are deleted, then the ones that still have a
+// value are inserted again, each statement is kept within maxPacketSize unless a single row does not fit
+std::vector<std::string> getChangedStorageQueries(const StorageMap& storages, std::string_view table,
+                                                  std::string_view ownerColumn, uint32_t ownerId, size_t maxPacketSize);
+
+#endif // FS_STORAGEMAP_H
@@ -14,10 +14,12 @@ TalkActions::~TalkActions() { clear(false); }
 
 void TalkActions::clear(bool fromLua)
 {
+	talkActionsByWords.clear();
 	for (auto it = talkActions.begin(); it != talkActions.end();) {
 		if (fromLua == it->second.fromLua) {
 			it = talkActions.erase(it);
 		} else {
+			talkActionsByWords.insert(it->first, &it->second);
 			++it;
 		}
 	}
@@ -38,11 +40,7 @@ Event_ptr TalkActions::getEvent(std::string_view nodeName)
 bool TalkActions::registerEvent(Event_ptr event, const pugi::xml_node&)
 {
 	TalkAction_ptr talkAction{static_cast<TalkAction*>(event.release())}; // event is guaranteed to be a TalkAction
-	const auto& words = talkAction->stealWordsMap();
-
-	for (const auto& word : words) {
-		talkActions.emplace(word, *talkAction);
-	}
+	registerWords(talkAction->stealWordsMap(), *talkAction);
 	return true;
 }
 
@@ -56,59 +54,64 @@ bool TalkActions::registerLuaEvent(TalkAction* event)
 		return false;
 	}
 
-	for (const auto& word : words) {
-		talkActions.emplace(word, *talkAction);
-	}
+	registerWords(words, *talkAction);
 	return true;
 }
 
-TalkActionResult TalkActions::playerSaySpell(Player* player, SpeakClasses type, std::string_view words) const
+void TalkActions::registerWords(const std::vector<std::string>& words, const TalkAction& talkAction)
 {
-	size_t wordsLength = words.length();
-	for (auto it = talkActions.begin(); it != talkActions.end();) {
-		std::string_view talkactionWords = it->first;
-		if (!caseInsensitiveStartsWith(words, talkactionWords)) {
-			++it;
-			continue;
+	for (const auto& word : words) {
+		auto result = talkActions.emplace(word, talkAction);
+		if (result.second) {
+			talkActionsByWords.insert(result.first->first, &result.first->second);
 		}
+	}
+}
 
-		std::string param;
-		if (wordsLength != talkactionWords.size()) {
-			param = words.substr(talkactionWords.size());
-			if (param.front() != ' ') {
-				++it;
-				continue;
-			}
-			boost::algorithm::trim_left(param);
-
-			auto separator = it->second.getSeparator();
-			if (separator != " ") {
-				if (!param.empty()) {
-					if (param != separator) {
-						++it;
-						continue;
-					} else {
-						param.erase(param.begin());
-					}
-				}
-			}
-		}
+TalkActionResult TalkActions::playerSaySpell(Player* player, SpeakClasses type, std::string_view words) const
+{
+	// the shortest matching words win, "/a" is tried before "/ab" and before "/AB"; words that only differ in case
+	// are tried in std::map order
+	std::string param;
+	const TalkAction* talkAction =
+	    talkActionsByWords.findPrefix(words, [&](std::string_view talkactionWords, const TalkAction& candidate) {
+		    param.clear();
+		    if (words.length() == talkactionWords.size()) {
+			    return true;
+		    }
+
+		    param = words.substr(talkactionWords.size());
+		    if (param.front() != ' ') {
+			    return false;
+		    }
+		    boost::algorithm::trim_left(param);
+
+		    auto separator = candidate.getSeparator();
+		    if (separator != " " && !param.empty()) {
+			    if (param != separator) {
+				    return false;
+			    }
+			    param.erase(param.begin());
+		    }
+		    return true;
+	    });
+
+	if (!talkAction) {
+		return TalkActionResult::CONTINUE;
+	}
 
-		if (it->second.getNeedAccess() && !player->isAccessPlayer()) {
-			return TalkActionResult::CONTINUE;
-		}
+	if (talkAction->getNeedAccess() && !player->isAccessPlayer()) {
+		return TalkActionResult::CONTINUE;
+	}
 
-		if (player->getAccountType() < it->second.getRequiredAccountType()) {
-			return TalkActionResult::CONTINUE;
-		}
+	if (player->getAccountType() < talkAction->getRequiredAccountType()) {
+		return TalkActionResult::CONTINUE;
+	}
 
-		if (it->second.executeSay(player, words, param, type)) {
-			return TalkActionResult::CONTINUE;
-		} else {
-			return TalkActionResult::BREAK;
-		}
+	if (talkAction->executeSay(player, words, param, type)) {
+		return TalkActionResult::CONTINUE;
 	}
-	return TalkActionResult::CONTINUE;
+	return TalkActionResult::BREAK;
 }
 
 bool TalkAction::configureEvent(const pugi::xml_node& node)
@@ -155,8 +158,7 @@ bool TalkAction::executeSay(Player* player, std::string_view words, std::string_
 
 	scriptInterface->pushFunction(scriptId);
 
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 
 	Lua::pushString(L, words);
 	Lua::pushString(L, param);
@@ -7,6 +7,7 @@
 #include "baseevents.h"
 #include "const.h"
 #include "luascript.h"
+#include "prefixtree.h"
 
 class TalkAction;
 using TalkAction_ptr = std::unique_ptr<TalkAction>;
@@ -84,7 +85,10 @@ private:
 	Event_ptr getEvent(std::string_view nodeName) override;
 	bool registerEvent(Event_ptr event, const pugi::xml_node& node) override;
 
+	void registerWords(const std::vector<std::string>& words, const TalkAction& talkAction);
+
 	std::map<std::string, TalkAction> talkActions;
+	PrefixTree<const TalkAction> talkActionsByWords;
 
 	LuaScriptInterface scriptInterface;
 };
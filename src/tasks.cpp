@@ -23,6 +23,12 @@ void Dispatcher::threadMain()
 	while (getState() != THREAD_STATE_TERMINATED) {
 		// check if there are tasks waiting
 		taskLockUnique.lock();
+		if (taskList.empty() && idleTask) {
+			taskLockUnique.unlock();
+			idleTask();
+			taskLockUnique.lock();
+		}
+
 		if (taskList.empty()) {
 			// if the list is empty wait for signal
 			taskSignal.wait(taskLockUnique);
@@ -53,6 +53,9 @@ public:
 
 	void addTask(uint32_t expiration, TaskFunc&& f) { addTask(new Task(expiration, std::move(f))); }
 
+	// runs on the dispatcher thread whenever it runs out of tasks, before it waits for new ones
+	void setIdleTask(TaskFunc&& f) { idleTask = std::move(f); }
+
 	void shutdown();
 
 	uint64_t getDispatcherCycle() const { return dispatcherCycle; }
@@ -64,6 +67,7 @@ private:
 	std::condition_variable taskSignal;
 
 	std::vector<Task*> taskList;
+	TaskFunc idleTask;
 	uint64_t dispatcherCycle = 0;
 };
 
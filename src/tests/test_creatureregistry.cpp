@@ -0,0 +1,89 @@
+#define BOOST_TEST_MODULE creatureregistry
+
+#include "../otpch.h"
+
+#include "../creatureregistry.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+struct Dummy
+{
+	uint32_t value;
+};
+
+using Registry = CreatureRegistry<Dummy, 0x40000000, 20, 10>;
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_creatureregistry_generations)
+{
+	Registry registry;
+	Dummy first{1}, second{2};
+
+	uint32_t firstId = registry.reserve();
+	BOOST_TEST(Registry::contains(firstId));
+	BOOST_TEST(!registry.get(firstId));
+
+	registry.set(firstId, &first);
+	BOOST_TEST(registry.get(firstId) == &first);
+	BOOST_TEST(registry.size() == 1u);
+
+	// a removed creature keeps its id until it is destroyed, it just no longer resolves
+	registry.set(firstId, nullptr);
+	BOOST_TEST(!registry.get(firstId));
+	BOOST_TEST(registry.size() == 0u);
+
+	registry.release(firstId);
+	uint32_t secondId = registry.reserve();
+	registry.set(secondId, &second);
+
+	// the slot is reused with a new generation, the stale id must not resolve to the new creature
+	BOOST_TEST((secondId & 0xFFFFF) == (firstId & 0xFFFFF));
+	BOOST_TEST(secondId != firstId);
+	BOOST_TEST(!registry.get(firstId));
+	BOOST_TEST(registry.get(secondId) == &second);
+
+	registry.set(firstId, &first);
+	BOOST_TEST(registry.get(secondId) == &second);
+
+	BOOST_TEST(!Registry::contains(0x3FFFFFFF));
+	BOOST_TEST(Registry::contains(0x7FFFFFFF));
+	BOOST_TEST(!Registry::contains(0x80000000));
+	BOOST_TEST(!registry.get(0));
+}
+
+BOOST_AUTO_TEST_CASE(test_creatureregistry_reuses_oldest_slot)
+{
+	Registry registry;
+	std::vector<uint32_t> ids;
+	for (int i = 0; i < 4; ++i) {
+		ids.push_back(registry.reserve());
+	}
+
+	registry.release(ids[2]);
+	registry.release(ids[0]);
+
+	BOOST_TEST((registry.reserve() & 0xFFFFF) == (ids[2] & 0xFFFFF));
+	BOOST_TEST((registry.reserve() & 0xFFFFF) == (ids[0] & 0xFFFFF));
+	BOOST_TEST((registry.reserve() & 0xFFFFF) == 4u);
+}
+
+BOOST_AUTO_TEST_CASE(test_creatureregistry_never_reuses_ids)
+{
+	// 4 slots with 4 generations each: 16 ids, then the registry is exhausted
+	using SmallRegistry = CreatureRegistry<Dummy, 1, 2, 2>;
+	SmallRegistry registry;
+
+	std::set<uint32_t> seen;
+	while (uint32_t id = registry.reserve()) {
+		BOOST_TEST_REQUIRE(seen.insert(id).second);
+		BOOST_TEST(SmallRegistry::contains(id));
+		registry.release(id);
+	}
+	BOOST_TEST(seen.size() == 16u);
+
+	// a retired slot does not resolve its last id any more
+	BOOST_TEST(!registry.get(*seen.rbegin()));
+}
@@ -0,0 +1,44 @@
+#define BOOST_TEST_MODULE iologindata
+
+#include "../otpch.h"
+
+#include "../iologindata.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(test_iologindata_login_without_writes)
+{
+	const uint64_t token = IOLoginData::beginLogin(1);
+	IOLoginData::notifyPlayerWrite(2);
+	BOOST_TEST(!IOLoginData::endLogin(1, token));
+}
+
+BOOST_AUTO_TEST_CASE(test_iologindata_write_during_login)
+{
+	const uint64_t token = IOLoginData::beginLogin(1);
+	IOLoginData::notifyPlayerWrite(1);
+	BOOST_TEST(IOLoginData::endLogin(1, token));
+
+	// once the login is over writes are none of its business
+	IOLoginData::notifyPlayerWrite(1);
+	BOOST_TEST(!IOLoginData::endLogin(1, token));
+}
+
+BOOST_AUTO_TEST_CASE(test_iologindata_script_write_during_login)
+{
+	const uint64_t first = IOLoginData::beginLogin(1);
+	const uint64_t second = IOLoginData::beginLogin(2);
+	IOLoginData::notifyUnknownWrite();
+	BOOST_TEST(IOLoginData::endLogin(1, first));
+	BOOST_TEST(IOLoginData::endLogin(2, second));
+}
+
+BOOST_AUTO_TEST_CASE(test_iologindata_concurrent_logins)
+{
+	// two clients log in to the same character, only the one that started before the write is stale
+	const uint64_t first = IOLoginData::beginLogin(1);
+	IOLoginData::notifyPlayerWrite(1);
+	const uint64_t second = IOLoginData::beginLogin(1);
+	BOOST_TEST(IOLoginData::endLogin(1, first));
+	BOOST_TEST(!IOLoginData::endLogin(1, second));
+}
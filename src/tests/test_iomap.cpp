@@ -0,0 +1,67 @@
+#define BOOST_TEST_MODULE iomap
+
+#include "../otpch.h"
+
+#include "../iomap.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+struct ItemsFixture
+{
+	ItemsFixture()
+	{
+		// items.xml is looked up relative to the working directory
+		std::filesystem::current_path(TFS_DATA_DIR "/..");
+		loaded = Item::items.loadFromOtb("data/items/items.otb") && Item::items.loadFromXml();
+	}
+
+	bool loaded;
+};
+
+size_t countHouseTiles(const Map& map)
+{
+	size_t count = 0;
+	for (const auto& it : map.houses.getHouses()) {
+		count += it.second->getTiles().size();
+	}
+	return count;
+}
+
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(test_iomap_parallel_load, ItemsFixture)
+{
+	const std::filesystem::path fileName = TFS_DATA_DIR "/world/forgotten.otbm";
+	if (!loaded || !std::filesystem::exists(fileName)) {
+		BOOST_TEST_MESSAGE("items or forgotten.otbm not found, skipping");
+		return;
+	}
+
+	Map serialMap;
+	IOMap serialLoader;
+	serialLoader.setThreadCount(1);
+	BOOST_TEST_REQUIRE(serialLoader.loadMap(&serialMap, fileName));
+
+	Map parallelMap;
+	IOMap parallelLoader;
+	BOOST_TEST_REQUIRE(parallelLoader.loadMap(&parallelMap, fileName));
+
+	const auto& serial = serialLoader.getLoadMetrics();
+	const auto& parallel = parallelLoader.getLoadMetrics();
+	BOOST_TEST(serial.threads == 1u);
+	BOOST_TEST(serial.tileAreas == parallel.tileAreas);
+	BOOST_TEST(serial.tiles == parallel.tiles);
+	BOOST_TEST(serial.tiles > 0u);
+	BOOST_TEST(countHouseTiles(serialMap) == countHouseTiles(parallelMap));
+
+	for (const auto& it : serialMap.towns.getTowns()) {
+		const Position& templePos = it.second->getTemplePosition();
+		const Tile* serialTile = serialMap.getTile(templePos);
+		const Tile* parallelTile = parallelMap.getTile(templePos);
+		BOOST_TEST_REQUIRE((serialTile && parallelTile));
+		BOOST_TEST(serialTile->getThingCount() == parallelTile->getThingCount());
+		BOOST_TEST(serialTile->getGround()->getID() == parallelTile->getGround()->getID());
+	}
+}
@@ -0,0 +1,136 @@
+#define BOOST_TEST_MODULE luaawait
+
+#include "../otpch.h"
+
+#include "../database.h"
+#include "../luascript.h"
+
+#include <boost/test/unit_test.hpp>
+
+extern LuaEnvironment g_luaEnvironment;
+
+namespace {
+
+std::vector<LuaScriptInterface::AwaitHandle> pending;
+std::vector<LuaScriptInterface*> resumedWith;
+
+// stands in for db.await, the test resumes the coroutine instead of the database thread
+int luaTestAwait(lua_State* L)
+{
+	pending.push_back(LuaScriptInterface::prepareAwait(L));
+	return LuaScriptInterface::yieldAwait(L);
+}
+
+int luaTestInterface(lua_State*)
+{
+	resumedWith.push_back(LuaScriptInterface::getScriptEnv()->getScriptInterface());
+	return 0;
+}
+
+// only the lifetime of the result is tracked, it is never read
+DBResult_ptr makeResult()
+{
+	static int dummy;
+	return DBResult_ptr{std::shared_ptr<void>{}, reinterpret_cast<DBResult*>(&dummy)};
+}
+
+struct AwaitFixture
+{
+	AwaitFixture()
+	{
+		BOOST_TEST_REQUIRE(interface->initState());
+		L = g_luaEnvironment.getLuaState();
+		lua_register(L, "testAwait", luaTestAwait);
+		lua_register(L, "testInterface", luaTestInterface);
+		pending.clear();
+		resumedWith.clear();
+	}
+
+	// runs code in a script environment of the test interface, as an event would
+	void run(const char* code)
+	{
+		BOOST_TEST_REQUIRE(LuaScriptInterface::reserveScriptEnv());
+		LuaScriptInterface::getScriptEnv()->setScriptId(EVENT_ID_USER, interface.get());
+		BOOST_TEST_REQUIRE(luaL_dostring(L, code) == LUA_OK);
+		LuaScriptInterface::resetScriptEnv();
+	}
+
+	lua_Integer getGlobalInteger(const char* name)
+	{
+		lua_getglobal(L, name);
+		lua_Integer value = lua_tointeger(L, -1);
+		lua_pop(L, 1);
+		return value;
+	}
+
+	std::unique_ptr<LuaScriptInterface> interface = std::make_unique<LuaScriptInterface>("Test Interface");
+	lua_State* L = nullptr;
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(test_luaawait_keeps_results_until_the_end, AwaitFixture)
+{
+	run(R"(
+		co = coroutine.create(function()
+			first = testAwait()
+			testInterface()
+			second = testAwait()
+			testInterface()
+		end)
+		coroutine.resume(co)
+	)");
+	BOOST_TEST_REQUIRE(pending.size() == 1u);
+
+	LuaScriptInterface::resumeAwait(pending[0], makeResult());
+	BOOST_TEST_REQUIRE(pending.size() == 2u);
+	const auto first = static_cast<uint32_t>(getGlobalInteger("first"));
+	BOOST_TEST(first != 0u);
+	BOOST_TEST((resumedWith == std::vector<LuaScriptInterface*>{interface.get()}));
+
+	// the result outlives the script environment and the next await
+	BOOST_TEST(ScriptEnvironment::getResultByID(first) != nullptr);
+
+	LuaScriptInterface::resumeAwait(pending[1], nullptr);
+	lua_getglobal(L, "second");
+	BOOST_TEST((lua_type(L, -1) == LUA_TBOOLEAN && !lua_toboolean(L, -1)));
+	lua_pop(L, 1);
+
+	// the coroutine ended, its results are freed
+	BOOST_TEST(ScriptEnvironment::getResultByID(first) == nullptr);
+	BOOST_TEST(lua_gettop(L) == 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_luaawait_other_yield_frees_results, AwaitFixture)
+{
+	run(R"(
+		co = coroutine.create(function()
+			first = testAwait()
+			coroutine.yield()
+		end)
+		coroutine.resume(co)
+	)");
+	BOOST_TEST_REQUIRE(pending.size() == 1u);
+
+	LuaScriptInterface::resumeAwait(pending[0], makeResult());
+	const auto first = static_cast<uint32_t>(getGlobalInteger("first"));
+	BOOST_TEST(first != 0u);
+	BOOST_TEST(ScriptEnvironment::getResultByID(first) == nullptr);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_luaawait_interface_gone, AwaitFixture)
+{
+	run(R"(
+		co = coroutine.create(function()
+			testAwait()
+			testInterface()
+		end)
+		coroutine.resume(co)
+	)");
+	BOOST_TEST_REQUIRE(pending.size() == 1u);
+
+	// a reload destroys the interface while the query runs
+	interface.reset();
+	LuaScriptInterface::resumeAwait(pending[0], nullptr);
+	BOOST_TEST((resumedWith == std::vector<LuaScriptInterface*>{&g_luaEnvironment}));
+}
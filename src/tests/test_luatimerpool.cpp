@@ -0,0 +1,121 @@
+#define BOOST_TEST_MODULE luatimerpool
+
+#include "../otpch.h"
+
+#include "../luatimerpool.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+struct Timer
+{
+	int32_t function = -1;
+	std::vector<int32_t> parameters;
+};
+
+using Pool = LuaTimerPool<Timer>;
+
+std::vector<int32_t> fireDue(Pool& pool, int64_t now)
+{
+	std::vector<int32_t> fired;
+	while (uint64_t id = pool.nextDue(now)) {
+		fired.push_back(pool.find(id)->function);
+		pool.erase(id);
+	}
+	return fired;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_luatimerpool_fires_in_order)
+{
+	Pool pool;
+	const int64_t delays[] = {300, 100, 200, 100};
+	for (int32_t i = 0; i < 4; ++i) {
+		pool.find(pool.add(delays[i]))->function = i;
+	}
+
+	BOOST_TEST(pool.nextDueTime().value_or(-1) == 100);
+	BOOST_TEST(fireDue(pool, 99).empty());
+	// equal due times fire in the order they were added
+	BOOST_TEST((fireDue(pool, 200) == std::vector<int32_t>{1, 3, 2}));
+	BOOST_TEST(pool.size() == 1u);
+	BOOST_TEST((fireDue(pool, 1000) == std::vector<int32_t>{0}));
+	BOOST_TEST(!pool.nextDueTime());
+}
+
+BOOST_AUTO_TEST_CASE(test_luatimerpool_erase)
+{
+	Pool pool;
+	uint64_t first = pool.add(100);
+	uint64_t second = pool.add(200);
+	BOOST_TEST(first != 0);
+	pool.find(first)->parameters = {1, 2, 3};
+	pool.find(second)->function = 2;
+
+	BOOST_TEST(pool.erase(first));
+	BOOST_TEST(!pool.erase(first));
+	BOOST_TEST(!pool.find(first));
+
+	// the slot is reused with its memory, the stale id does not match the new timer
+	uint64_t third = pool.add(50);
+	BOOST_TEST((third & 0xFFFFF) == (first & 0xFFFFF));
+	BOOST_TEST(third != first);
+	BOOST_TEST(pool.find(third)->parameters.capacity() >= 3u);
+	BOOST_TEST(!pool.erase(first));
+	pool.find(third)->function = 3;
+
+	// the erased timer is skipped when its due time comes up
+	BOOST_TEST((fireDue(pool, 1000) == std::vector<int32_t>{3, 2}));
+	BOOST_TEST(pool.size() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(test_luatimerpool_matches_multimap)
+{
+	// many short timers, some stopped before they fire, against a descriptor map and a sorted timer per event
+	constexpr int timers = 10000;
+	constexpr int64_t tick = 50;
+
+	std::mt19937 generator{42};
+	std::vector<int64_t> delays(timers);
+	for (auto& delay : delays) {
+		delay = 100 + generator() % 2000;
+	}
+
+	std::unordered_map<uint32_t, int32_t> descriptors;
+	std::multimap<int64_t, uint32_t> scheduled;
+	std::vector<int32_t> expected;
+	Pool pool;
+	std::vector<int32_t> fired;
+	int64_t now = 0;
+	for (int32_t i = 0; i < timers; ++i) {
+		uint32_t id = static_cast<uint32_t>(i);
+		descriptors.emplace(id, i);
+		scheduled.emplace(now + delays[i], id);
+
+		uint64_t pooledId = pool.add(now + delays[i]);
+		pool.find(pooledId)->function = i;
+		if (i % 4 == 0) {
+			descriptors.erase(id);
+			pool.erase(pooledId);
+		}
+
+		if (i % 100 == 0) {
+			now += tick;
+			while (!scheduled.empty() && scheduled.begin()->first <= now) {
+				auto it = descriptors.find(scheduled.begin()->second);
+				if (it != descriptors.end()) {
+					expected.push_back(it->second);
+					descriptors.erase(it);
+				}
+				scheduled.erase(scheduled.begin());
+			}
+
+			auto due = fireDue(pool, now);
+			fired.insert(fired.end(), due.begin(), due.end());
+		}
+	}
+
+	BOOST_TEST(fired == expected);
+}
@@ -0,0 +1,102 @@
+#define BOOST_TEST_MODULE luauserdata
+
+#include "../otpch.h"
+
+#include "../luascript.h"
+#include "../player.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+struct Dummy
+{
+	uint32_t id;
+};
+
+struct LuaState
+{
+	LuaState()
+	{
+		L = luaL_newstate();
+		luaL_openlibs(L);
+		luaL_newmetatable(L, "Dummy");
+		lua_pop(L, 1);
+	}
+	~LuaState() { lua_close(L); }
+
+	lua_State* L;
+};
+
+void pushUncached(lua_State* L, Dummy* dummy)
+{
+	Lua::pushUserdata<Dummy>(L, dummy);
+	Lua::setMetatable(L, -1, "Dummy");
+}
+
+void pushCached(lua_State* L, Dummy* dummy)
+{
+	if (Lua::pushCachedUserdata(L, dummy->id, dummy)) {
+		return;
+	}
+
+	pushUncached(L, dummy);
+	Lua::cacheUserdata(L, dummy->id);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_luauserdata_cache)
+{
+	LuaState state;
+	lua_State* L = state.L;
+	Dummy first{0x10000000}, second{0x10000001};
+
+	pushCached(L, &first);
+	pushCached(L, &first);
+	BOOST_TEST(lua_rawequal(L, -1, -2));
+	BOOST_TEST(Lua::getUserdata<Dummy>(L, -1, false) == &first);
+
+	pushCached(L, &second);
+	BOOST_TEST(!lua_rawequal(L, -1, -2));
+	lua_pop(L, 3);
+	BOOST_TEST(lua_gettop(L) == 0);
+
+	// an entry pointing to another object under the same key is not returned
+	Dummy reused{first.id};
+	pushCached(L, &reused);
+	BOOST_TEST(Lua::getUserdata<Dummy>(L, -1, false) == &reused);
+	lua_pop(L, 1);
+
+	// the cache does not keep userdata alive
+	lua_gc(L, LUA_GCCOLLECT);
+	BOOST_TEST(!Lua::pushCachedUserdata(L, first.id, &reused));
+	BOOST_TEST(lua_gettop(L) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_luauserdata_push_creature)
+{
+	LuaState state;
+	lua_State* L = state.L;
+
+	Player* player = new Player(nullptr);
+	player->incrementReferenceCounter();
+
+	// offline players have no id and get a fresh userdata every time
+	Lua::pushCreature(L, player);
+	Lua::pushCreature(L, player);
+	BOOST_TEST(!lua_rawequal(L, -1, -2));
+	BOOST_TEST(Lua::getUserdata<Creature>(L, -1, false) == player);
+	lua_pop(L, 2);
+
+	player->setID();
+	BOOST_TEST(player->getID() != 0);
+	Lua::pushCreature(L, player);
+	Lua::pushCreature(L, player);
+	BOOST_TEST(lua_rawequal(L, -1, -2));
+	BOOST_TEST(Lua::getUserdata<Creature>(L, -1, false) == player);
+	lua_pop(L, 2);
+	BOOST_TEST(lua_gettop(L) == 0);
+
+	player->decrementReferenceCounter();
+}
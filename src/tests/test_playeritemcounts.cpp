@@ -0,0 +1,72 @@
+#define BOOST_TEST_MODULE playeritemcounts
+
+#include "../otpch.h"
+
+#include "../container.h"
+#include "../player.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+struct PlayerFixture
+{
+	PlayerFixture()
+	{
+		// items.xml is looked up relative to the working directory
+		std::filesystem::current_path(TFS_DATA_DIR "/..");
+		BOOST_TEST_REQUIRE((Item::items.loadFromOtb("data/items/items.otb") && Item::items.loadFromXml()));
+
+		player = new Player(nullptr);
+		player->incrementReferenceCounter();
+	}
+	~PlayerFixture() { player->decrementReferenceCounter(); }
+
+	Item* createItem(uint16_t itemId, uint16_t count = 0)
+	{
+		Item* item = Item::CreateItem(itemId, count);
+		item->incrementReferenceCounter();
+		return item;
+	}
+
+	Player* player;
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(test_playeritemcounts_follow_the_inventory, PlayerFixture)
+{
+	Container* backpack = createItem(ITEM_BACKPACK)->getContainer();
+	BOOST_TEST_REQUIRE(backpack);
+	backpack->internalAddThing(createItem(ITEM_GOLD_COIN, 100));
+	static_cast<Cylinder*>(player)->internalAddThing(CONST_SLOT_BACKPACK, backpack);
+
+	// the first query builds the counts
+	BOOST_TEST(player->getItemTypeCount(ITEM_GOLD_COIN) == 100u);
+	BOOST_TEST(player->getItemTypeCount(ITEM_BACKPACK) == 1u);
+
+	// from then on they follow every change, nested containers included
+	Container* bag = createItem(ITEM_BACKPACK)->getContainer();
+	bag->internalAddThing(createItem(ITEM_PLATINUM_COIN, 5));
+	backpack->addThing(bag);
+	BOOST_TEST(player->getItemTypeCount(ITEM_PLATINUM_COIN) == 5u);
+	BOOST_TEST(player->getItemTypeCount(ITEM_BACKPACK) == 2u);
+
+	Item* gold = backpack->getItemByIndex(1);
+	BOOST_TEST_REQUIRE(gold->getID() == ITEM_GOLD_COIN);
+	backpack->removeThing(gold, 30);
+	BOOST_TEST(player->getItemTypeCount(ITEM_GOLD_COIN) == 70u);
+
+	backpack->updateThing(gold, ITEM_PLATINUM_COIN, 1);
+	BOOST_TEST(player->getItemTypeCount(ITEM_GOLD_COIN) == 0u);
+	BOOST_TEST(player->getItemTypeCount(ITEM_PLATINUM_COIN) == 6u);
+
+	backpack->removeThing(bag, bag->getItemCount());
+	BOOST_TEST(player->getItemTypeCount(ITEM_PLATINUM_COIN) == 1u);
+	BOOST_TEST(player->getItemTypeCount(ITEM_BACKPACK) == 1u);
+	bag->decrementReferenceCounter();
+
+	std::map<uint32_t, uint32_t> countMap;
+	static_cast<const Cylinder*>(player)->getAllItemTypeCount(countMap);
+	BOOST_TEST((countMap == std::map<uint32_t, uint32_t>{{ITEM_BACKPACK, 1}, {ITEM_PLATINUM_COIN, 1}}));
+}
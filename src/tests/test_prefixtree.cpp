@@ -0,0 +1,106 @@
+#define BOOST_TEST_MODULE prefixtree
+
+#include "../otpch.h"
+
+#include "../prefixtree.h"
+#include "../tools.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+struct Words
+{
+	std::string words;
+};
+
+const Words* findLongestLinear(const std::map<std::string, Words>& map, std::string_view str)
+{
+	const Words* result = nullptr;
+	for (const auto& it : map) {
+		if (caseInsensitiveStartsWith(str, it.first) && (!result || it.first.size() > result->words.size())) {
+			result = &it.second;
+		}
+	}
+	return result;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_prefixtree_longest_prefix)
+{
+	std::map<std::string, Words> map;
+	PrefixTree<Words> tree;
+	for (std::string_view words : {"exura", "exura vita", "exura gran", "utani hur", "utani gran hur"}) {
+		auto it = map.emplace(words, Words{std::string{words}}).first;
+		tree.insert(it->first, &it->second);
+	}
+
+	BOOST_TEST(tree.findLongestPrefix("exura")->first == "exura");
+	BOOST_TEST(tree.findLongestPrefix("EXURA VITA")->first == "exura vita");
+	BOOST_TEST(tree.findLongestPrefix("exura vitax")->first == "exura vita");
+	BOOST_TEST(tree.findLongestPrefix("exura san")->first == "exura");
+	BOOST_TEST(tree.findLongestPrefix("utani gran hur")->first == "utani gran hur");
+	BOOST_TEST(!tree.findLongestPrefix("utani gran"));
+	BOOST_TEST(!tree.findLongestPrefix(""));
+}
+
+BOOST_AUTO_TEST_CASE(test_prefixtree_find_prefix_order)
+{
+	std::map<std::string, Words> map;
+	PrefixTree<Words> tree;
+	for (std::string_view words : {"!a", "!ab", "!AB", "/goto"}) {
+		auto it = map.emplace(words, Words{std::string{words}}).first;
+		tree.insert(it->first, &it->second);
+	}
+
+	// shortest key first, keys of the same length in std::map order; std::map alone would put "!AB" before "!a"
+	std::vector<std::string_view> visited;
+	tree.findPrefix("!ab x", [&](std::string_view key, const Words&) {
+		visited.push_back(key);
+		return false;
+	});
+	BOOST_TEST(visited == (std::vector<std::string_view>{"!a", "!AB", "!ab"}), boost::test_tools::per_element());
+
+	auto found = tree.findPrefix("/GOTO Thais", [](std::string_view, const Words&) { return true; });
+	BOOST_TEST(found->words == "/goto");
+
+	tree.clear();
+	BOOST_TEST(tree.empty());
+	BOOST_TEST(!tree.findPrefix("!a", [](std::string_view, const Words&) { return true; }));
+}
+
+BOOST_AUTO_TEST_CASE(test_prefixtree_matches_linear_scan)
+{
+	pugi::xml_document doc;
+	if (!doc.load_file(TFS_DATA_DIR "/spells/spells.xml")) {
+		BOOST_TEST_MESSAGE("spells.xml not found, skipping");
+		return;
+	}
+
+	std::map<std::string, Words> map;
+	PrefixTree<Words> tree;
+	for (auto& node : doc.child("spells").children("instant")) {
+		std::string words = node.attribute("words").as_string();
+		auto [it, inserted] = map.emplace(words, Words{words});
+		if (inserted) {
+			tree.insert(it->first, &it->second);
+		}
+	}
+
+	// every spell as spoken, with a parameter and as plain chat that matches nothing
+	std::vector<std::string> lines;
+	for (const auto& it : map) {
+		std::string upper = it.first;
+		std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+
+		lines.push_back(it.first);
+		lines.push_back(upper + " \"Param\"");
+		lines.push_back("hello " + it.first);
+	}
+
+	for (const auto& line : lines) {
+		auto entry = tree.findLongestPrefix(line);
+		BOOST_TEST((entry ? entry->second : nullptr) == findLongestLinear(map, line));
+	}
+}
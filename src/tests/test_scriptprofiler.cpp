@@ -0,0 +1,91 @@
+#define BOOST_TEST_MODULE scriptprofiler
+
+#include "../otpch.h"
+
+#include "../scriptprofiler.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+// stack -> self time in microseconds
+std::map<std::string, int64_t> parseFoldedStacks(const std::string& folded)
+{
+	std::map<std::string, int64_t> stacks;
+	std::istringstream stream{folded};
+	std::string line;
+	while (std::getline(stream, line)) {
+		auto separator = line.rfind(' ');
+		BOOST_TEST_REQUIRE(separator != std::string::npos);
+		stacks.emplace(line.substr(0, separator), std::stoll(line.substr(separator + 1)));
+	}
+	return stacks;
+}
+
+void busyWait(std::chrono::microseconds duration)
+{
+	auto end = std::chrono::steady_clock::now() + duration;
+	while (std::chrono::steady_clock::now() < end) {
+	}
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_scriptprofiler_nested_calls)
+{
+	ScriptProfiler profiler;
+	profiler.start();
+
+	// an action that moves an item, which runs a movement script
+	auto start = std::chrono::steady_clock::now();
+	profiler.enter("data/actions/scripts/lever.lua:1");
+	busyWait(std::chrono::milliseconds(2));
+	profiler.enter("data/movements/scripts/tile;trap.lua:4");
+	busyWait(std::chrono::milliseconds(4));
+	profiler.leave();
+	profiler.leave();
+
+	profiler.enter("data/actions/scripts/lever.lua:1");
+	profiler.leave();
+	auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+	auto stacks = parseFoldedStacks(profiler.getFoldedStacks());
+	BOOST_TEST_REQUIRE(stacks.size() == 2u);
+
+	// frames are separated by ';', so it is replaced inside a frame name
+	const std::string nested = "data/actions/scripts/lever.lua:1;data/movements/scripts/tile,trap.lua:4";
+	BOOST_TEST_REQUIRE(stacks.contains(nested));
+	BOOST_TEST(stacks[nested] >= 4000);
+
+	// the time spent in the movement script is not counted again for the action, so the self times add up to no
+	// more than the time the calls took
+	const std::string outer = "data/actions/scripts/lever.lua:1";
+	BOOST_TEST(stacks[outer] >= 2000);
+	BOOST_TEST(stacks[outer] + stacks[nested] <= elapsed.count());
+}
+
+BOOST_AUTO_TEST_CASE(test_scriptprofiler_unpaired_leave)
+{
+	ScriptProfiler profiler;
+
+	// started from inside a script: the leave of that script has no enter
+	profiler.start();
+	profiler.enter("data/talkactions/scripts/profiler.lua:1");
+	profiler.leave();
+	profiler.leave();
+
+	auto stacks = parseFoldedStacks(profiler.getFoldedStacks());
+	BOOST_TEST(stacks.size() == 1u);
+	BOOST_TEST(stacks.contains("data/talkactions/scripts/profiler.lua:1"));
+
+	// restarting drops the frames still open and what was collected
+	profiler.enter("data/scripts/unfinished.lua:1");
+	profiler.start();
+	profiler.enter("data/scripts/next.lua:1");
+	profiler.leave();
+	profiler.leave();
+
+	stacks = parseFoldedStacks(profiler.getFoldedStacks());
+	BOOST_TEST(stacks.size() == 1u);
+	BOOST_TEST(stacks.contains("data/scripts/next.lua:1"));
+}
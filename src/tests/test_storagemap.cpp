@@ -0,0 +1,128 @@
+#define BOOST_TEST_MODULE storagemap
+
+#include "../otpch.h"
+
+#include "../storagemap.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+std::map<uint32_t, int64_t> collectDirty(const StorageMap& storages)
+{
+	std::map<uint32_t, int64_t> dirty;
+	storages.forEachDirty(
+	    [&](uint32_t key, std::optional<int64_t> value) { dirty.emplace(key, value.value_or(-1)); });
+	return dirty;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_storagemap_matches_std_map)
+{
+	std::map<uint32_t, int64_t> reference;
+	FlatHashMap<int64_t> map;
+
+	std::mt19937 generator{42};
+	for (int i = 0; i < 200000; ++i) {
+		uint32_t key = generator() % 4096;
+		if (generator() % 3 == 0) {
+			BOOST_TEST_REQUIRE(map.erase(key) == (reference.erase(key) == 1));
+		} else {
+			int64_t value = generator();
+			BOOST_TEST_REQUIRE(map.insert_or_assign(key, value) == reference.insert_or_assign(key, value).second);
+		}
+	}
+
+	BOOST_TEST(map.size() == reference.size());
+	for (uint32_t key = 0; key < 4096; ++key) {
+		auto it = reference.find(key);
+		const int64_t* value = map.find(key);
+		BOOST_TEST_REQUIRE((value != nullptr) == (it != reference.end()));
+		if (value) {
+			BOOST_TEST(*value == it->second);
+		}
+	}
+
+	size_t visited = 0;
+	map.forEach([&](uint32_t key, int64_t value) {
+		BOOST_TEST(reference.at(key) == value);
+		++visited;
+	});
+	BOOST_TEST(visited == reference.size());
+}
+
+BOOST_AUTO_TEST_CASE(test_storagemap_dirty_keys)
+{
+	StorageMap storages;
+	storages.set(1, 10, false);
+	storages.set(2, 20, false);
+	storages.set(3, 30, false);
+	BOOST_TEST(!storages.hasDirty());
+	BOOST_TEST(storages.size() == 3u);
+
+	storages.set(2, 21);
+	storages.set(2, 22);
+	storages.set(3, std::nullopt);
+	storages.set(4, 40);
+	storages.set(5, std::nullopt);
+	BOOST_TEST(storages.hasDirty());
+	// changed and erased keys are reported once, erasing a missing key is not a change
+	BOOST_TEST((collectDirty(storages) == std::map<uint32_t, int64_t>{{2, 22}, {3, -1}, {4, 40}}));
+
+	storages.clearDirty();
+	BOOST_TEST(!storages.hasDirty());
+	BOOST_TEST(storages.get(1).value_or(-1) == 10);
+	BOOST_TEST(storages.get(2).value_or(-1) == 22);
+	BOOST_TEST(!storages.get(3));
+	BOOST_TEST(storages.get(4).value_or(-1) == 40);
+}
+
+BOOST_AUTO_TEST_CASE(test_storagemap_save_queries_split)
+{
+	StorageMap storages;
+	for (uint32_t key = 0; key < 2000; ++key) {
+		storages.set(key, key, false);
+	}
+	// more changes than fit in one packet, every third one erases its key
+	for (uint32_t key = 0; key < 2000; ++key) {
+		storages.set(key, key % 3 == 0 ? std::nullopt : std::optional<int64_t>{key + 1});
+	}
+
+	constexpr size_t maxPacketSize = 1024;
+	auto queries = getChangedStorageQueries(storages, "player_storage", "player_id", 7, maxPacketSize);
+	BOOST_TEST_REQUIRE(queries.size() > 2u);
+
+	std::set<uint32_t> deleted;
+	std::map<uint32_t, int64_t> inserted;
+	bool inserting = false;
+	for (const std::string& query : queries) {
+		BOOST_TEST(query.length() <= maxPacketSize);
+		if (query.starts_with("DELETE FROM `player_storage` WHERE `player_id` = 7 AND `key` IN (")) {
+			// a key that is still in the table makes the insert fail, so no delete may follow an insert
+			BOOST_TEST(!inserting);
+			BOOST_TEST(query.ends_with(")"));
+			std::istringstream keys{query.substr(query.find('(') + 1)};
+			for (uint32_t key; keys >> key; keys.ignore()) {
+				BOOST_TEST(deleted.insert(key).second);
+			}
+		} else {
+			BOOST_TEST_REQUIRE(query.starts_with("INSERT INTO `player_storage` (`player_id`, `key`, `value`) VALUES "));
+			inserting = true;
+			std::istringstream rows{query.substr(query.find("VALUES ") + 7)};
+			uint32_t owner, key;
+			int64_t value;
+			char separator;
+			while (rows >> separator >> owner >> separator >> key >> separator >> value >> separator) {
+				BOOST_TEST(owner == 7u);
+				BOOST_TEST(inserted.emplace(key, value).second);
+				rows >> separator;
+			}
+		}
+	}
+
+	BOOST_TEST(deleted.size() == 2000u);
+	BOOST_TEST(inserted.size() == 2000u - 667u);
+	BOOST_TEST(inserted[1] == 2);
+	BOOST_TEST(!inserted.contains(3));
+}
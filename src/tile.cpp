@@ -12,12 +12,39 @@
 #include "mailbox.h"
 #include "monster.h"
 #include "movement.h"
+#include "slab.h"
 #include "teleport.h"
 #include "trashholder.h"
 
 extern Game g_game;
 extern MoveEvents* g_moveEvents;
 
+namespace {
+
+SlabAllocator& getStaticTileAllocator()
+{
+	// never destroyed, tiles may still be released during static destruction
+	static auto* allocator = new SlabAllocator("StaticTile", sizeof(StaticTile));
+	return *allocator;
+}
+
+SlabAllocator& getDynamicTileAllocator()
+{
+	// never destroyed, tiles may still be released during static destruction
+	static auto* allocator = new SlabAllocator("DynamicTile", sizeof(DynamicTile));
+	return *allocator;
+}
+
+} // namespace
+
+void* StaticTile::operator new(size_t size) { return getStaticTileAllocator().allocate(size); }
+
+void StaticTile::operator delete(void* p, size_t size) { getStaticTileAllocator().deallocate(p, size); }
+
+void* DynamicTile::operator new(size_t size) { return getDynamicTileAllocator().allocate(size); }
+
+void DynamicTile::operator delete(void* p, size_t size) { getDynamicTileAllocator().deallocate(p, size); }
+
 StaticTile real_nullptr_tile(0xFFFF, 0xFFFF, 0xFF);
 Tile& Tile::nullptr_tile = real_nullptr_tile;
 
@@ -261,6 +261,10 @@ class DynamicTile : public Tile
 
 public:
 	DynamicTile(uint16_t x, uint16_t y, uint8_t z) : Tile(x, y, z) {}
+	// allocated from a slab, see slab.h
+	static void* operator new(size_t size);
+	static void operator delete(void* p, size_t size);
+
 	~DynamicTile()
 	{
 		for (Item* item : items) {
@@ -292,6 +296,10 @@ class StaticTile final : public Tile
 
 public:
 	StaticTile(uint16_t x, uint16_t y, uint8_t z) : Tile(x, y, z) {}
+	// allocated from a slab, see slab.h
+	static void* operator new(size_t size);
+	static void operator delete(void* p, size_t size);
+
 	~StaticTile()
 	{
 		if (items) {
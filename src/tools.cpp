@@ -60,6 +60,15 @@ void printXMLError(std::string_view where, std::string_view fileName, const pugi
 	std::cout << '^' << std::endl;
 }
 
+uint64_t fnv1a(const char* data, size_t size)
+{
+	uint64_t hash = 0xcbf29ce484222325;
+	for (size_t i = 0; i < size; ++i) {
+		hash = (hash ^ static_cast<uint8_t>(data[i])) * 0x100000001b3;
+	}
+	return hash;
+}
+
 std::string transformToSHA1(std::string_view input)
 {
 	std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> ctx{EVP_MD_CTX_new(), EVP_MD_CTX_free};
@@ -291,8 +300,8 @@ IntegerVector vectorAtoi(const std::vector<std::string_view>& stringVector)
 
 std::mt19937& getRandomGenerator()
 {
-	static std::random_device rd;
-	static std::mt19937 generator(rd());
+	// items created while loading the map in parallel roll their durations on loader threads
+	thread_local std::mt19937 generator(std::random_device{}());
 	return generator;
 }
 
@@ -13,6 +13,9 @@
 
 void printXMLError(std::string_view where, std::string_view fileName, const pugi::xml_parse_result& result);
 
+// 64-bit FNV-1a, a fast checksum and cache key, not for anything that needs to resist tampering
+uint64_t fnv1a(const char* data, size_t size);
+
 std::string transformToSHA1(std::string_view input);
 std::string transformToSHA1Hex(std::string_view input);
 std::string generateToken(const std::string& key, uint32_t ticks);
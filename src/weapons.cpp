@@ -21,26 +21,24 @@ Weapons::~Weapons() { clear(false); }
 
 const Weapon* Weapons::getWeapon(const Item* item) const
 {
-	if (!item) {
+	if (!item || !Item::items[item->getID()].hasScriptEvent(ITEM_SCRIPT_WEAPON)) {
 		return nullptr;
 	}
+	return weapons.get(item->getID());
+}
 
-	auto it = weapons.find(item->getID());
-	if (it == weapons.end()) {
-		return nullptr;
-	}
-	return it->second;
+void Weapons::setWeapon(uint16_t id, Weapon* weapon)
+{
+	weapons.set(id, weapon);
+	Item::items.setScriptEvent(id, ITEM_SCRIPT_WEAPON);
 }
 
 void Weapons::clear(bool fromLua)
 {
-	for (auto it = weapons.begin(); it != weapons.end();) {
-		if (fromLua == it->second->fromLua) {
-			it = weapons.erase(it);
-		} else {
-			++it;
-		}
-	}
+	weapons.eraseIf([fromLua](const Weapon& weapon) { return fromLua == weapon.fromLua; });
+
+	Item::items.resetScriptEvents(ITEM_SCRIPT_WEAPON);
+	weapons.forEach([](uint16_t id, const Weapon&) { Item::items.setScriptEvent(id, ITEM_SCRIPT_WEAPON); });
 
 	reInitState(fromLua);
 }
@@ -53,7 +51,7 @@ void Weapons::loadDefaults()
 {
 	for (size_t i = 100, size = Item::items.size(); i < size; ++i) {
 		const ItemType& it = Item::items.getItemType(i);
-		if (it.id == 0 || weapons.find(i) != weapons.end()) {
+		if (it.id == 0 || weapons.get(i)) {
 			continue;
 		}
 
@@ -63,7 +61,7 @@ void Weapons::loadDefaults()
 			case WEAPON_CLUB: {
 				WeaponMelee* weapon = new WeaponMelee(&scriptInterface);
 				weapon->configureWeapon(it);
-				weapons[i] = weapon;
+				setWeapon(i, weapon);
 				break;
 			}
 
@@ -75,7 +73,7 @@ void Weapons::loadDefaults()
 
 				WeaponDistance* weapon = new WeaponDistance(&scriptInterface);
 				weapon->configureWeapon(it);
-				weapons[i] = weapon;
+				setWeapon(i, weapon);
 				break;
 			}
 
@@ -101,17 +99,19 @@ bool Weapons::registerEvent(Event_ptr event, const pugi::xml_node&)
 {
 	Weapon* weapon = static_cast<Weapon*>(event.release()); // event is guaranteed to be a Weapon
 
-	auto result = weapons.emplace(weapon->getID(), weapon);
-	if (!result.second) {
+	if (weapons.get(weapon->getID())) {
 		std::cout << "[Warning - Weapons::registerEvent] Duplicate registered item with id: " << weapon->getID()
 		          << std::endl;
+		return false;
 	}
-	return result.second;
+
+	setWeapon(weapon->getID(), weapon);
+	return true;
 }
 
 bool Weapons::registerLuaEvent(Weapon* weapon)
 {
-	weapons[weapon->getID()] = weapon;
+	setWeapon(weapon->getID(), weapon);
 	return true;
 }
 
@@ -473,8 +473,7 @@ bool Weapon::executeUseWeapon(Player* player, const LuaVariant& var) const
 	lua_State* L = scriptInterface->getLuaState();
 
 	scriptInterface->pushFunction(scriptId);
-	Lua::pushUserdata<Player>(L, player);
-	Lua::setMetatable(L, -1, "Player");
+	Lua::pushCreature(L, player);
 	Lua::pushVariant(L, var);
 
 	return scriptInterface->callFunction(2);
@@ -7,6 +7,7 @@
 #include "baseevents.h"
 #include "combat.h"
 #include "const.h"
+#include "idtable.h"
 #include "player.h"
 #include "vocation.h"
 
@@ -44,7 +45,9 @@ private:
 	Event_ptr getEvent(std::string_view nodeName) override;
 	bool registerEvent(Event_ptr event, const pugi::xml_node& node) override;
 
-	std::map<uint32_t, Weapon*> weapons;
+	void setWeapon(uint16_t id, Weapon* weapon);
+
+	IdTable<Weapon> weapons;
 
 	LuaScriptInterface scriptInterface{"Weapon Interface"};
 };